@@ -184,6 +184,10 @@ void BraveBrowserProcessImpl::Init() {
 void BraveBrowserProcessImpl::StartTearDown() {
   brave_stats_updater_.reset();
   brave_referrals_service_.reset();
+  if (p3a_service_) {
+    // Persist histogram samples still waiting to be coalesced.
+    p3a_service_->FlushPendingHistogramValues();
+  }
   BrowserProcessImpl::StartTearDown();
 }
 
@@ -5,8 +5,11 @@
 
 #include "brave/browser/net/brave_block_safebrowsing_urls.h"
 
+#include <iterator>
 #include <vector>
 
+#include "base/no_destructor.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
 #include "url/gurl.h"
@@ -15,34 +18,39 @@ namespace brave {
 
 const char kDummyUrl[] = "https://no-thanks.invalid";
 
+namespace {
+
+// Reporting URLs that are still allowed. Checked before kReportingPatterns.
+constexpr const char* kAllowedPatterns[] = {
+    "https://sb-ssl.google.com/safebrowsing/clientreport/download*",
+    "https://safebrowsing.google.com/safebrowsing/clientreport/crx-list-info*",
+};
+
+constexpr const char* kReportingPatterns[] = {
+    "https://sb-ssl.google.com/safebrowsing/clientreport/*",
+    "https://safebrowsing.google.com/safebrowsing/clientreport/*",
+    "https://safebrowsing.google.com/safebrowsing/report*",
+    "https://safebrowsing.google.com/safebrowsing/uploads/*",
+};
+
+// kAllowedPatterns followed by kReportingPatterns, indexed by host.
+const URLPatternHostIndex& GetPatterns() {
+  static const base::NoDestructor<URLPatternHostIndex> patterns([] {
+    std::vector<URLPattern> patterns;
+    for (const char* pattern : kAllowedPatterns)
+      patterns.emplace_back(URLPattern::SCHEME_HTTPS, pattern);
+    for (const char* pattern : kReportingPatterns)
+      patterns.emplace_back(URLPattern::SCHEME_HTTPS, pattern);
+    return patterns;
+  }());
+  return *patterns;
+}
+
+}  // namespace
+
 bool IsSafeBrowsingReportingURL(const GURL& gurl) {
-  static const std::vector<URLPattern> allowed_patterns({
-      URLPattern(
-          URLPattern::SCHEME_HTTPS,
-          "https://sb-ssl.google.com/safebrowsing/clientreport/download*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/clientreport/"
-                 "crx-list-info*"),
-  });
-  static const std::vector<URLPattern> reporting_patterns({
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://sb-ssl.google.com/safebrowsing/clientreport/*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/clientreport/*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/report*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/uploads/*"),
-  });
-
-  if (std::any_of(
-          allowed_patterns.begin(), allowed_patterns.end(),
-          [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); })) {
-    return false;
-  }
-  return std::any_of(
-      reporting_patterns.begin(), reporting_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+  const absl::optional<size_t> match = GetPatterns().FindFirstMatch(gurl);
+  return match && *match >= std::size(kAllowedPatterns);
 }
 
 int OnBeforeURLRequest_BlockSafeBrowsingReportingURLs(const GURL& request_url,
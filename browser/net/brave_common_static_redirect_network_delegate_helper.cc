@@ -7,9 +7,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/components/constants/network_constants.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
@@ -18,6 +21,26 @@ namespace brave {
 
 namespace {
 
+// Indices into GetCommonStaticRedirectRules(), in priority order.
+enum CommonStaticRedirectRule {
+  kChromeCastRule,
+  kClients4Rule,
+  kBugsChromiumRule,
+};
+
+const URLPatternHostIndex& GetCommonStaticRedirectRules() {
+  constexpr int kHttpOrHttps =
+      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+  static const base::NoDestructor<URLPatternHostIndex> rules(
+      std::vector<URLPattern>{
+          URLPattern(kHttpOrHttps, kChromeCastPrefix),
+          URLPattern(kHttpOrHttps, kClients4Prefix),
+          URLPattern(kHttpOrHttps,
+                     "*://bugs.chromium.org/p/chromium/issues/entry?*"),
+      });
+  return *rules;
+}
+
 bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
   GURL url("https://github.com/brave/brave-browser/issues/new");
   std::string query = "title=Crash%20Report&labels=crash";
@@ -61,32 +84,34 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     GURL* new_url) {
   DCHECK(new_url);
 
-  GURL::Replacements replacements;
-  static URLPattern chromecast_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
-  static URLPattern clients4_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kClients4Prefix);
-  static URLPattern bugsChromium_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://bugs.chromium.org/p/chromium/issues/entry?*");
-
-  if (chromecast_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (clients4_pattern.MatchesHost(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveClients4Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (bugsChromium_pattern.MatchesURL(request_url)) {
-    if (RewriteBugReportingURL(request_url, new_url))
-      return net::OK;
+  const URLPatternHostIndex& rules = GetCommonStaticRedirectRules();
+  for (size_t index : rules.GetCandidates(request_url)) {
+    const URLPattern& pattern = rules.pattern(index);
+    GURL::Replacements replacements;
+    switch (static_cast<CommonStaticRedirectRule>(index)) {
+      case kChromeCastRule:
+        if (pattern.MatchesURL(request_url)) {
+          replacements.SetSchemeStr("https");
+          replacements.SetHostStr(kBraveRedirectorProxy);
+          *new_url = request_url.ReplaceComponents(replacements);
+          return net::OK;
+        }
+        break;
+      case kClients4Rule:
+        if (pattern.MatchesHost(request_url)) {
+          replacements.SetSchemeStr("https");
+          replacements.SetHostStr(kBraveClients4Proxy);
+          *new_url = request_url.ReplaceComponents(replacements);
+          return net::OK;
+        }
+        break;
+      case kBugsChromiumRule:
+        if (pattern.MatchesURL(request_url) &&
+            RewriteBugReportingURL(request_url, new_url)) {
+          return net::OK;
+        }
+        break;
+    }
   }
 
   return net::OK;
@@ -8,8 +8,11 @@
 #include <string>
 #include <vector>
 
+#include "base/check.h"
+#include "base/containers/contains.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/fixed_flat_set.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
@@ -78,10 +81,24 @@ static constexpr auto kScopedQueryStringTrackers =
         {"ref_url", "twitter.com"},
     });
 
+// Compiles the conditional tracker patterns once, so a URL is matched against
+// all of them in a single pass. Pattern i belongs to the i-th tracker.
+const re2::RE2::Set& ConditionalTrackersRegexSet() {
+  static const base::NoDestructor<re2::RE2::Set> kRegexSet([] {
+    re2::RE2::Set regex_set(re2::RE2::DefaultOptions, re2::RE2::UNANCHORED);
+    for (const auto& tracker : kConditionalQueryStringTrackers) {
+      CHECK_NE(-1, regex_set.Add(tracker.second, nullptr));
+    }
+    CHECK(regex_set.Compile());
+    return regex_set;
+  }());
+  return *kRegexSet;
+}
+
 // Remove tracking query parameters from a GURL, leaving all
 // other parts untouched.
 absl::optional<std::string> StripQueryParameter(const base::StringPiece& query,
-                                                const std::string& spec) {
+                                                const GURL& url) {
   // We are using custom query string parsing code here. See
   // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
   // for more information on why this approach was selected.
@@ -92,6 +109,21 @@ absl::optional<std::string> StripQueryParameter(const base::StringPiece& query,
   const std::vector<base::StringPiece> input_kv_strings =
       SplitStringPiece(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
   std::vector<base::StringPiece> output_kv_strings;
+  // Indices of the conditional trackers whose pattern matches |url|, computed
+  // on the first conditional tracker found.
+  absl::optional<std::vector<int>> conditional_matches;
+  auto is_disallowed_conditional_tracker = [&](base::StringPiece key) {
+    const auto it = kConditionalQueryStringTrackers.find(key);
+    if (it == kConditionalQueryStringTrackers.end()) {
+      return false;
+    }
+    if (!conditional_matches) {
+      conditional_matches.emplace();
+      ConditionalTrackersRegexSet().Match(url.spec(), &*conditional_matches);
+    }
+    const int index = it - kConditionalQueryStringTrackers.begin();
+    return !base::Contains(*conditional_matches, index);
+  };
   int disallowed_count = 0;
   for (const auto& kv_string : input_kv_strings) {
     const std::vector<base::StringPiece> pieces = SplitStringPiece(
@@ -100,10 +132,8 @@ absl::optional<std::string> StripQueryParameter(const base::StringPiece& query,
     if (pieces.size() >= 2 &&
         (kSimpleQueryStringTrackers.count(key) == 1 ||
          (kScopedQueryStringTrackers.count(key) == 1 &&
-          GURL(spec).DomainIs(kScopedQueryStringTrackers.at(key).data())) ||
-         (kConditionalQueryStringTrackers.count(key) == 1 &&
-          !re2::RE2::PartialMatch(
-              spec, kConditionalQueryStringTrackers.at(key).data())))) {
+          url.DomainIs(kScopedQueryStringTrackers.at(key))) ||
+         is_disallowed_conditional_tracker(key))) {
       ++disallowed_count;
     } else {
       output_kv_strings.push_back(kv_string);
@@ -119,8 +149,7 @@ absl::optional<std::string> StripQueryParameter(const base::StringPiece& query,
 
 absl::optional<GURL> ApplyQueryFilter(const GURL& original_url) {
   const auto& query = original_url.query_piece();
-  const std::string& spec = original_url.spec();
-  const auto clean_query_value = StripQueryParameter(query, spec);
+  const auto clean_query_value = StripQueryParameter(query, original_url);
   if (!clean_query_value.has_value())
     return absl::nullopt;
   const auto& clean_query = clean_query_value.value();
@@ -80,8 +80,14 @@ int OnBeforeStartTransaction_ReduceLanguageWork(
   if (origin_url.is_empty()) {
     return net::OK;
   }
-  if (!brave_shields::ShouldDoReduceLanguage(content_settings, origin_url,
-                                             profile->GetPrefs())) {
+  // The settings of the tab origin may have been resolved when |ctx| was
+  // created.
+  const bool use_snapshot =
+      ctx->shields_settings && origin_url == ctx->tab_origin;
+  if (use_snapshot ? !brave_shields::ShouldDoReduceLanguage(
+                         *ctx->shields_settings, profile->GetPrefs())
+                   : !brave_shields::ShouldDoReduceLanguage(
+                         content_settings, origin_url, profile->GetPrefs())) {
     return net::OK;
   }
   base::StringPiece origin_host(origin_url.host_piece());
@@ -102,8 +108,9 @@ int OnBeforeStartTransaction_ReduceLanguageWork(
   }
 
   std::string accept_language_string;
-  switch (brave_shields::GetFingerprintingControlType(content_settings,
-                                                      origin_url)) {
+  switch (use_snapshot ? ctx->shields_settings->fingerprinting_control_type
+                       : brave_shields::GetFingerprintingControlType(
+                             content_settings, origin_url)) {
     case ControlType::BLOCK: {
       // If fingerprint blocking is maximum, set Accept-Language header to
       // static value regardless of other preferences.
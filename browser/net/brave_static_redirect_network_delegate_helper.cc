@@ -5,13 +5,15 @@
 
 #include "brave/browser/net/brave_static_redirect_network_delegate_helper.h"
 
-#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include "base/strings/string_piece_forward.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "brave/browser/net/brave_geolocation_buildflags.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/browser/safebrowsing/buildflags.h"
 #include "brave/components/constants/network_constants.h"
 #include "extensions/common/url_pattern.h"
@@ -25,6 +27,82 @@ namespace {
 
 bool g_safebrowsing_api_endpoint_for_testing_ = false;
 
+constexpr int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+enum StaticRedirectRuleFlags {
+  // Only the host of the request has to match the pattern.
+  kMatchHostOnly = 1 << 0,
+  // The rule only applies when a Safe Browsing endpoint is configured.
+  kNeedsSafeBrowsingEndpoint = 1 << 1,
+  kUpgradeToHttps = 1 << 2,
+};
+
+enum class RedirectTo {
+  // Requests matching the rule are left alone, even if a later rule matches
+  // them too.
+  kNowhere,
+  kGoogleApis,
+  kSafeBrowsingEndpoint,
+  // StaticRedirectRule::host.
+  kHost,
+};
+
+struct StaticRedirectRule {
+  int valid_schemes;
+  const char* pattern;
+  int flags;
+  RedirectTo redirect_to;
+  const char* host;
+};
+
+// The first rule that matches a request decides where it is redirected.
+// To-Do (@jumde) - Give the CRLSet patterns more meaningful names
+// https://github.com/brave/brave-browser/issues/10314
+constexpr StaticRedirectRule kStaticRedirectRules[] = {
+    {URLPattern::SCHEME_HTTPS, kGeoLocationsPattern, 0, RedirectTo::kGoogleApis,
+     nullptr},
+    {URLPattern::SCHEME_HTTPS, kSafeBrowsingPrefix,
+     kMatchHostOnly | kNeedsSafeBrowsingEndpoint,
+     RedirectTo::kSafeBrowsingEndpoint, nullptr},
+    {URLPattern::SCHEME_HTTPS, kSafeBrowsingFileCheckPrefix,
+     kMatchHostOnly | kNeedsSafeBrowsingEndpoint, RedirectTo::kHost,
+     kBraveSafeBrowsingSslProxy},
+    {URLPattern::SCHEME_HTTPS, kSafeBrowsingCrxListPrefix,
+     kMatchHostOnly | kNeedsSafeBrowsingEndpoint, RedirectTo::kHost,
+     kBraveSafeBrowsing2Proxy},
+    {kHttpOrHttps, kCRXDownloadPrefix, kUpgradeToHttps, RedirectTo::kHost,
+     "crxdownload.brave.com"},
+    {URLPattern::SCHEME_HTTPS, kAutofillPrefix, kUpgradeToHttps,
+     RedirectTo::kHost, kBraveStaticProxy},
+    {kHttpOrHttps, kCRLSetPrefix1, kUpgradeToHttps, RedirectTo::kHost,
+     kBraveRedirectorProxy},
+    {kHttpOrHttps, kCRLSetPrefix2, kUpgradeToHttps, RedirectTo::kHost,
+     kBraveRedirectorProxy},
+    {kHttpOrHttps, kCRLSetPrefix3, kUpgradeToHttps, RedirectTo::kHost,
+     kBraveRedirectorProxy},
+    {kHttpOrHttps, kCRLSetPrefix4, kUpgradeToHttps, RedirectTo::kHost,
+     kBraveRedirectorProxy},
+    {kHttpOrHttps, kWidevineGvt1Prefix, 0, RedirectTo::kNowhere, nullptr},
+    {kHttpOrHttps, "*://*.gvt1.com/*", kUpgradeToHttps, RedirectTo::kHost,
+     kBraveRedirectorProxy},
+    {kHttpOrHttps, kWidevineGoogleDlPrefix, 0, RedirectTo::kNowhere, nullptr},
+    {kHttpOrHttps, "*://dl.google.com/*", kUpgradeToHttps, RedirectTo::kHost,
+     kBraveRedirectorProxy},
+};
+
+// kStaticRedirectRules compiled into URLPatterns and indexed by host, so
+// that a request is only matched against the rules for its host.
+const URLPatternHostIndex& GetStaticRedirectRules() {
+  static const base::NoDestructor<URLPatternHostIndex> rules([] {
+    std::vector<URLPattern> patterns;
+    patterns.reserve(std::size(kStaticRedirectRules));
+    for (const auto& rule : kStaticRedirectRules)
+      patterns.emplace_back(rule.valid_schemes, rule.pattern);
+    return patterns;
+  }());
+  return *rules;
+}
+
 base::StringPiece GetSafeBrowsingEndpoint() {
   if (g_safebrowsing_api_endpoint_for_testing_)
     return kSafeBrowsingTestingEndpoint;
@@ -52,122 +130,36 @@ int OnBeforeURLRequest_StaticRedirectWork(
 int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
-  GURL::Replacements replacements;
-  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
-  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingPrefix);
-  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
-                                                  kSafeBrowsingFileCheckPrefix);
-  static URLPattern safebrowsingcrxlist_pattern(URLPattern::SCHEME_HTTPS,
-                                                kSafeBrowsingCrxListPrefix);
-
-  // To-Do (@jumde) - Update the naming for the variables below
-  // https://github.com/brave/brave-browser/issues/10314
-  static URLPattern crlSet_pattern1(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix1);
-  static URLPattern crlSet_pattern2(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix2);
-  static URLPattern crlSet_pattern3(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix3);
-  static URLPattern crlSet_pattern4(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix4);
-  static URLPattern crxDownload_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRXDownloadPrefix);
-  static URLPattern autofill_pattern(
-      URLPattern::SCHEME_HTTPS, kAutofillPrefix);
-  static URLPattern gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, "*://*.gvt1.com/*");
-  static URLPattern googleDl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://dl.google.com/*");
-
-  static URLPattern widevine_gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGvt1Prefix);
-  static URLPattern widevine_google_dl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGoogleDlPrefix);
-
-  if (geo_pattern.MatchesURL(request_url)) {
-    *new_url = GURL(BUILDFLAG(GOOGLEAPIS_URL));
-    return net::OK;
-  }
-
-  auto safebrowsing_endpoint = GetSafeBrowsingEndpoint();
-  if (!safebrowsing_endpoint.empty() &&
-      safeBrowsing_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(safebrowsing_endpoint);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingcrxlist_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crxDownload_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crxdownload.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (autofill_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveStaticProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern1.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern2.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern3.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern4.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-  if (gvt1_pattern.MatchesURL(request_url) &&
-      !widevine_gvt1_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (googleDl_pattern.MatchesURL(request_url) &&
-      !widevine_google_dl_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
+  const URLPatternHostIndex& rules = GetStaticRedirectRules();
+  const base::StringPiece safebrowsing_endpoint = GetSafeBrowsingEndpoint();
+  for (size_t index : rules.GetCandidates(request_url)) {
+    const StaticRedirectRule& rule = kStaticRedirectRules[index];
+    if ((rule.flags & kNeedsSafeBrowsingEndpoint) &&
+        safebrowsing_endpoint.empty()) {
+      continue;
+    }
+    const URLPattern& pattern = rules.pattern(index);
+    if ((rule.flags & kMatchHostOnly) ? !pattern.MatchesHost(request_url)
+                                      : !pattern.MatchesURL(request_url)) {
+      continue;
+    }
+
+    GURL::Replacements replacements;
+    if (rule.flags & kUpgradeToHttps)
+      replacements.SetSchemeStr("https");
+    switch (rule.redirect_to) {
+      case RedirectTo::kNowhere:
+        return net::OK;
+      case RedirectTo::kGoogleApis:
+        *new_url = GURL(BUILDFLAG(GOOGLEAPIS_URL));
+        return net::OK;
+      case RedirectTo::kSafeBrowsingEndpoint:
+        replacements.SetHostStr(safebrowsing_endpoint);
+        break;
+      case RedirectTo::kHost:
+        replacements.SetHostStr(rule.host);
+        break;
+    }
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
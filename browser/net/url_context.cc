@@ -10,6 +10,7 @@
 
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot_cache.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "brave/components/brave_webtorrent/browser/webtorrent_util.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
@@ -138,31 +139,56 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
 
   Profile* profile = Profile::FromBrowserContext(browser_context);
   auto* map = HostContentSettingsMapFactory::GetForProfile(profile);
-  ctx->allow_brave_shields =
-      map ? brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin) : true;
-  ctx->allow_ads =
-      map ? brave_shields::GetAdControlType(map, ctx->tab_origin) ==
-                brave_shields::ControlType::ALLOW
-          : false;
-  // Currently, "aggressive" mode is registered as a cosmetic filtering control
-  // type, even though it can also affect network blocking.
-  ctx->aggressive_blocking =
-      map ? brave_shields::GetCosmeticFilteringControlType(
-                map, ctx->tab_origin) == brave_shields::ControlType::BLOCK
-          : false;
-  ctx->allow_http_upgradable_resource =
-      map ? !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin)
-          : false;
+  // Every subresource of a page has the same settings, so they are resolved
+  // once per frame and top-frame origin.
+  content::WebContents* contents =
+      content::WebContents::FromFrameTreeNodeId(ctx->frame_tree_node_id);
+  if (map && contents) {
+    ctx->shields_settings =
+        brave_shields::ShieldsSettingsSnapshotCache::GetOrCreate(contents, map)
+            ->Get(ctx->frame_tree_node_id, ctx->tab_origin);
+    ctx->allow_brave_shields = ctx->shields_settings->shields_enabled;
+    ctx->allow_ads = ctx->shields_settings->ad_control_type ==
+                     brave_shields::ControlType::ALLOW;
+    // Currently, "aggressive" mode is registered as a cosmetic filtering
+    // control type, even though it can also affect network blocking.
+    ctx->aggressive_blocking =
+        ctx->shields_settings->cosmetic_filtering_control_type ==
+        brave_shields::ControlType::BLOCK;
+    ctx->allow_http_upgradable_resource =
+        !ctx->shields_settings->https_everywhere_enabled;
+  } else {
+    // Without a tab there is nothing to cache a snapshot in, so only the
+    // settings read here are looked up.
+    ctx->allow_brave_shields =
+        map ? brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin)
+            : true;
+    ctx->allow_ads =
+        map ? brave_shields::GetAdControlType(map, ctx->tab_origin) ==
+                  brave_shields::ControlType::ALLOW
+            : false;
+    ctx->aggressive_blocking =
+        map ? brave_shields::GetCosmeticFilteringControlType(
+                  map, ctx->tab_origin) == brave_shields::ControlType::BLOCK
+            : false;
+    ctx->allow_http_upgradable_resource =
+        map ? !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin)
+            : false;
+  }
 
   // HACK: after we fix multiple creations of BraveRequestInfo we should
   // use only tab_origin. Since we recreate BraveRequestInfo during consequent
   // stages of navigation, |tab_origin| changes and so does |allow_referrers|
   // flag, which is not what we want for determining referrers.
-  ctx->allow_referrers =
-      map ? brave_shields::AreReferrersAllowed(
-                map, ctx->redirect_source.is_empty() ? ctx->tab_origin
-                                                     : ctx->redirect_source)
-          : false;
+  if (ctx->shields_settings && ctx->redirect_source.is_empty()) {
+    ctx->allow_referrers = ctx->shields_settings->referrers_allowed;
+  } else {
+    ctx->allow_referrers =
+        map ? brave_shields::AreReferrersAllowed(
+                  map, ctx->redirect_source.is_empty() ? ctx->tab_origin
+                                                       : ctx->redirect_source)
+            : false;
+  }
   ctx->upload_data = GetUploadData(request);
 
   ctx->browser_context = browser_context;
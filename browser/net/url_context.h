@@ -11,6 +11,7 @@
 #include <string>
 
 #include "base/memory/raw_ptr.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
@@ -85,6 +86,9 @@ struct BraveRequestInfo {
   bool aggressive_blocking = false;
   bool allow_http_upgradable_resource = false;
   bool allow_referrers = false;
+  // Shields settings of |tab_origin|, which the flags above are taken from.
+  // Only set for requests that belong to a tab, where the snapshot is cached.
+  absl::optional<brave_shields::ShieldsSettingsSnapshot> shields_settings;
   bool is_webtorrent_disabled = false;
   int frame_tree_node_id = 0;
   uint64_t request_identifier = 0;
@@ -0,0 +1,80 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/check.h"
+#include "base/strings/string_piece.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+template <typename HostMap>
+void AppendCandidates(const HostMap& map,
+                      base::StringPiece host,
+                      std::vector<size_t>* candidates) {
+  auto it = map.find(host);
+  if (it != map.end()) {
+    candidates->insert(candidates->end(), it->second.begin(),
+                       it->second.end());
+  }
+}
+
+}  // namespace
+
+URLPatternHostIndex::URLPatternHostIndex(std::vector<URLPattern> patterns)
+    : patterns_(std::move(patterns)) {
+  for (size_t i = 0; i < patterns_.size(); ++i) {
+    const URLPattern& pattern = patterns_[i];
+    DCHECK(!pattern.host().empty()) << pattern.GetAsString();
+    if (pattern.match_subdomains()) {
+      subdomain_hosts_[pattern.host()].push_back(i);
+    } else {
+      exact_hosts_[pattern.host()].push_back(i);
+    }
+  }
+}
+
+URLPatternHostIndex::~URLPatternHostIndex() = default;
+
+std::vector<size_t> URLPatternHostIndex::GetCandidates(const GURL& url) const {
+  std::vector<size_t> candidates;
+  base::StringPiece host = url.host_piece();
+  // URLPattern ignores a trailing dot when matching hosts.
+  if (!host.empty() && host.back() == '.')
+    host.remove_suffix(1);
+  if (host.empty())
+    return candidates;
+
+  AppendCandidates(exact_hosts_, host, &candidates);
+  // Try the host itself and then every parent domain against the wildcard
+  // patterns: a.b.gvt1.com, b.gvt1.com, gvt1.com, com.
+  for (base::StringPiece domain = host;;) {
+    AppendCandidates(subdomain_hosts_, domain, &candidates);
+    const size_t dot = domain.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    domain.remove_prefix(dot + 1);
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+absl::optional<size_t> URLPatternHostIndex::FindFirstMatch(
+    const GURL& url) const {
+  for (size_t index : GetCandidates(url)) {
+    if (patterns_[index].MatchesURL(url))
+      return index;
+  }
+  return absl::nullopt;
+}
+
+}  // namespace brave
@@ -0,0 +1,57 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+#define BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "extensions/common/url_pattern.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+class GURL;
+
+namespace brave {
+
+// A fixed, ordered list of URLPatterns indexed by host, so that a request is
+// only matched against the patterns written for its host instead of all of
+// them. Every pattern must name a host, optionally with a "*." subdomain
+// wildcard.
+class URLPatternHostIndex {
+ public:
+  explicit URLPatternHostIndex(std::vector<URLPattern> patterns);
+  URLPatternHostIndex(const URLPatternHostIndex&) = delete;
+  URLPatternHostIndex& operator=(const URLPatternHostIndex&) = delete;
+  ~URLPatternHostIndex();
+
+  // Returns the indices, in increasing order, of the patterns whose host
+  // could match the host of |url|. The caller still has to match the
+  // candidates themselves.
+  std::vector<size_t> GetCandidates(const GURL& url) const;
+
+  // Returns the index of the first pattern that matches |url|.
+  absl::optional<size_t> FindFirstMatch(const GURL& url) const;
+
+  const URLPattern& pattern(size_t index) const { return patterns_[index]; }
+  size_t size() const { return patterns_.size(); }
+
+ private:
+  // Transparent so that lookups don't copy the host.
+  using HostMap =
+      base::flat_map<std::string, std::vector<size_t>, std::less<>>;
+
+  const std::vector<URLPattern> patterns_;
+  // Host -> patterns that only match that host.
+  HostMap exact_hosts_;
+  // Domain -> patterns that match the domain and all of its subdomains.
+  HostMap subdomain_hosts_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
@@ -0,0 +1,197 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include <vector>
+
+#include "base/strings/string_piece.h"
+#include "brave/browser/net/brave_geolocation_buildflags.h"
+#include "brave/browser/net/brave_static_redirect_network_delegate_helper.h"
+#include "brave/browser/safebrowsing/buildflags.h"
+#include "brave/components/constants/network_constants.h"
+#include "extensions/common/url_pattern.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+constexpr int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+// OnBeforeURLRequest_StaticRedirectWorkForGURL() as it was before the rules
+// were indexed by host, with the Safe Browsing endpoint passed in.
+GURL LegacyStaticRedirectWorkForGURL(const GURL& request_url,
+                                     base::StringPiece safebrowsing_endpoint) {
+  GURL::Replacements replacements;
+  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
+  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
+                                         kSafeBrowsingPrefix);
+  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
+                                                  kSafeBrowsingFileCheckPrefix);
+  static URLPattern safebrowsingcrxlist_pattern(URLPattern::SCHEME_HTTPS,
+                                                kSafeBrowsingCrxListPrefix);
+  static URLPattern crlSet_pattern1(kHttpOrHttps, kCRLSetPrefix1);
+  static URLPattern crlSet_pattern2(kHttpOrHttps, kCRLSetPrefix2);
+  static URLPattern crlSet_pattern3(kHttpOrHttps, kCRLSetPrefix3);
+  static URLPattern crlSet_pattern4(kHttpOrHttps, kCRLSetPrefix4);
+  static URLPattern crxDownload_pattern(kHttpOrHttps, kCRXDownloadPrefix);
+  static URLPattern autofill_pattern(URLPattern::SCHEME_HTTPS,
+                                     kAutofillPrefix);
+  static URLPattern gvt1_pattern(kHttpOrHttps, "*://*.gvt1.com/*");
+  static URLPattern googleDl_pattern(kHttpOrHttps, "*://dl.google.com/*");
+  static URLPattern widevine_gvt1_pattern(kHttpOrHttps, kWidevineGvt1Prefix);
+  static URLPattern widevine_google_dl_pattern(kHttpOrHttps,
+                                               kWidevineGoogleDlPrefix);
+
+  if (geo_pattern.MatchesURL(request_url)) {
+    return GURL(BUILDFLAG(GOOGLEAPIS_URL));
+  }
+  if (!safebrowsing_endpoint.empty() &&
+      safeBrowsing_pattern.MatchesHost(request_url)) {
+    replacements.SetHostStr(safebrowsing_endpoint);
+    return request_url.ReplaceComponents(replacements);
+  }
+  if (!safebrowsing_endpoint.empty() &&
+      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
+    replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
+    return request_url.ReplaceComponents(replacements);
+  }
+  if (!safebrowsing_endpoint.empty() &&
+      safebrowsingcrxlist_pattern.MatchesHost(request_url)) {
+    replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
+    return request_url.ReplaceComponents(replacements);
+  }
+  if (crxDownload_pattern.MatchesURL(request_url)) {
+    replacements.SetSchemeStr("https");
+    replacements.SetHostStr("crxdownload.brave.com");
+    return request_url.ReplaceComponents(replacements);
+  }
+  if (autofill_pattern.MatchesURL(request_url)) {
+    replacements.SetSchemeStr("https");
+    replacements.SetHostStr(kBraveStaticProxy);
+    return request_url.ReplaceComponents(replacements);
+  }
+  if (crlSet_pattern1.MatchesURL(request_url) ||
+      crlSet_pattern2.MatchesURL(request_url) ||
+      crlSet_pattern3.MatchesURL(request_url) ||
+      crlSet_pattern4.MatchesURL(request_url)) {
+    replacements.SetSchemeStr("https");
+    replacements.SetHostStr("redirector.brave.com");
+    return request_url.ReplaceComponents(replacements);
+  }
+  if ((gvt1_pattern.MatchesURL(request_url) &&
+       !widevine_gvt1_pattern.MatchesURL(request_url)) ||
+      (googleDl_pattern.MatchesURL(request_url) &&
+       !widevine_google_dl_pattern.MatchesURL(request_url))) {
+    replacements.SetSchemeStr("https");
+    replacements.SetHostStr(kBraveRedirectorProxy);
+    return request_url.ReplaceComponents(replacements);
+  }
+  return GURL();
+}
+
+}  // namespace
+
+// Runs the production rule table against the helper it replaced, so that a
+// reordered rule or a wrong scheme or match flag shows up as a difference.
+TEST(URLPatternHostIndexTest, StaticRedirectMatchesLegacyHelper) {
+  const char* const kURLs[] = {
+      "https://www.googleapis.com/geolocation/v1/geolocate?key=abc",
+      "http://www.googleapis.com/geolocation/v1/geolocate?key=abc",
+      "https://www.googleapis.com/geolocation/v1/other",
+      "https://safebrowsing.googleapis.com/v4/threatListUpdates:fetch",
+      "http://safebrowsing.googleapis.com/",
+      "https://a.safebrowsing.googleapis.com/",
+      "https://sb-ssl.google.com/safebrowsing/clientreport/download?x=1",
+      "https://sb-ssl.google.com/safebrowsing/clientreport/other",
+      "http://sb-ssl.google.com/x",
+      "https://safebrowsing.google.com/safebrowsing/clientreport/"
+      "crx-list-info",
+      "https://safebrowsing.google.com/other",
+      "http://safebrowsing.google.com/safebrowsing/report?x",
+      "https://clients2.googleusercontent.com/crx/blobs/a/b.crx",
+      "http://clients2.googleusercontent.com/crx/blobs/a/b.crx",
+      "https://clients2.googleusercontent.com/other/b.crx",
+      "https://www.gstatic.com/autofill/x",
+      "http://www.gstatic.com/autofill/x",
+      "https://www.gstatic.com/other/x",
+      "http://dl.google.com/release2/chrome_component/a_crl-set_b",
+      "https://dl.google.com/release2/chrome_component/"
+      "oimompecagnajdejgnnjijobebaeigek_crl-set",
+      "https://dl.google.com/foo/bar",
+      "http://dl.google.com/foo/bar",
+      "https://dl.google.com/oimompecagnajdejgnnjijobebaeigek/x.crx",
+      "http://dl.google.com/oimompecagnajdejgnnjijobebaeigek/x.crx",
+      "https://a.dl.google.com/foo",
+      "http://r1---sn-n4v7sn7y.gvt1.com/edgedl/release2/chrome_component/a",
+      "https://r1.gvt1.com/edgedl/release2/chrome_component/"
+      "oimompecagnajdejgnnjijobebaeigek",
+      "https://redirector.gvt1.com/edgedl/chromewebstore/x/"
+      "pkedcjkdefgpdelpbcmbmeomcjbeemfm.crx",
+      "https://a.b.gvt1.com/oimompecagnajdejgnnjijobebaeigek/c",
+      "http://r2.gvt1.com/edgedl/widevine-cdm/"
+      "oimompecagnajdejgnnjijobebaeigek.crx",
+      "https://gvt1.com/",
+      "https://gvt1.com./x",
+      "https://notgvt1.com/x",
+      "https://www.google.com/dl/release2/chrome_component/x",
+      "http://www.google.com/dl/release2/chrome_component/x",
+      "https://www.google.com/other",
+      "https://storage.googleapis.com/update-delta/"
+      "hfnkpimlhhgieaddgfemjhofmfblmnib/1.crxd",
+      "https://storage.googleapis.com/update-delta/other/1.crxd",
+      "https://DL.GOOGLE.COM/x",
+      "https://dl.google.com:8443/x",
+      "https://127.0.0.1/x",
+      "https://brave.com/",
+      "https://com/",
+      "file:///etc/passwd",
+      "about:blank",
+      "",
+  };
+  for (bool testing_endpoint : {false, true}) {
+    SetSafeBrowsingEndpointForTesting(testing_endpoint);
+    const base::StringPiece safebrowsing_endpoint =
+        testing_endpoint ? kSafeBrowsingTestingEndpoint
+                         : BUILDFLAG(SAFEBROWSING_ENDPOINT);
+    for (const char* spec : kURLs) {
+      const GURL url(spec);
+      GURL new_url;
+      OnBeforeURLRequest_StaticRedirectWorkForGURL(url, &new_url);
+      EXPECT_EQ(LegacyStaticRedirectWorkForGURL(url, safebrowsing_endpoint),
+                new_url)
+          << spec << " testing endpoint: " << testing_endpoint;
+    }
+  }
+  SetSafeBrowsingEndpointForTesting(false);
+}
+
+TEST(URLPatternHostIndexTest, Candidates) {
+  const URLPatternHostIndex index(std::vector<URLPattern>{
+      URLPattern(kHttpOrHttps, "*://*.gvt1.com/a/*"),
+      URLPattern(kHttpOrHttps, "*://dl.google.com/*"),
+      URLPattern(kHttpOrHttps, "*://r1.gvt1.com/*"),
+      URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"),
+  });
+
+  EXPECT_EQ(std::vector<size_t>({0, 2, 3}),
+            index.GetCandidates(GURL("https://r1.gvt1.com/x")));
+  EXPECT_EQ(std::vector<size_t>({0, 3}),
+            index.GetCandidates(GURL("https://a.r2.gvt1.com/x")));
+  EXPECT_EQ(std::vector<size_t>({0, 3}),
+            index.GetCandidates(GURL("https://gvt1.com./x")));
+  EXPECT_EQ(std::vector<size_t>({1}),
+            index.GetCandidates(GURL("https://dl.google.com/x")));
+  EXPECT_TRUE(index.GetCandidates(GURL("https://google.com/x")).empty());
+  EXPECT_TRUE(index.GetCandidates(GURL("about:blank")).empty());
+
+  EXPECT_EQ(2u, index.FindFirstMatch(GURL("https://r1.gvt1.com/b")));
+  EXPECT_EQ(0u, index.FindFirstMatch(GURL("https://r1.gvt1.com/a/b")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("http://google.com/a/b")));
+}
+
+}  // namespace brave
@@ -145,6 +145,7 @@ const std::u16string& CommanderService::GetPrompt() {
 }
 
 void CommanderService::Shutdown() {
+  ranker_.CommitPendingVisits();
   weak_ptr_factory_.InvalidateWeakPtrs();
 }
 
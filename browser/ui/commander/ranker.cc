@@ -10,9 +10,12 @@
 #include <iterator>
 #include <memory>
 #include <string>
-#include <tuple>
+#include <utility>
+#include <vector>
 
+#include "base/functional/bind.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/time/time.h"
 #include "brave/components/commander/common/pref_names.h"
 #include "chrome/browser/ui/commander/command_source.h"
@@ -24,56 +27,117 @@ namespace commander {
 
 namespace {
 constexpr double kDoubleComparisonSlop = 0.001;
-}
+constexpr base::TimeDelta kCommitDelay = base::Seconds(10);
+
+struct RankedItem {
+  double rank;
+  std::unique_ptr<CommandItem> item;
+};
+}  // namespace
 
 Ranker::Ranker(PrefService* prefs) : prefs_(prefs) {}
-Ranker::~Ranker() = default;
+
+Ranker::~Ranker() {
+  CommitPendingVisits();
+}
 
 void Ranker::Visit(const CommandItem& item) {
-  const auto id = GetId(item);
-  ScopedDictPrefUpdate update(prefs_, prefs::kCommanderFrecencies);
+  LoadFrecencies();
+
+  auto& frecency = frecencies_[item.title];
+  frecency.visit_count++;
+  frecency.last_visit = base::Time::Now();
+  dirty_ids_.insert(item.title);
 
-  auto* entry = update->EnsureDict(id);
-  auto visit_count = entry->FindInt("visit_count").value_or(0);
-  entry->Set("visit_count", visit_count + 1);
-  entry->Set("last_visit", base::Time::Now().ToJsTime());
+  if (!base::SequencedTaskRunner::HasCurrentDefault()) {
+    CommitPendingVisits();
+    return;
+  }
+  if (!commit_timer_.IsRunning()) {
+    commit_timer_.Start(FROM_HERE, kCommitDelay,
+                        base::BindOnce(&Ranker::CommitPendingVisits,
+                                       base::Unretained(this)));
+  }
 }
 
 double Ranker::GetRank(const CommandItem& item) {
-  const auto [visits, visit_time] = GetInfo(GetId(item));
-  return history::GetFrecencyScore(visits, visit_time, base::Time::Now());
+  return GetRank(item, base::Time::Now());
+}
+
+double Ranker::GetRank(const CommandItem& item, base::Time now) {
+  LoadFrecencies();
+
+  auto it = frecencies_.find(item.title);
+  if (it == frecencies_.end()) {
+    return history::GetFrecencyScore(0, base::Time::Min(), now);
+  }
+  return history::GetFrecencyScore(it->second.visit_count,
+                                   it->second.last_visit, now);
 }
 
 void Ranker::Rank(std::vector<std::unique_ptr<CommandItem>>& items,
                   size_t max_results) {
   max_results = std::min(items.size(), max_results);
+
+  // Score every item once up front rather than in the comparator, which runs
+  // O(n log k) times.
+  const base::Time now = base::Time::Now();
+  std::vector<RankedItem> ranked_items;
+  ranked_items.reserve(items.size());
+  for (auto& item : items) {
+    const double rank = (0.5 + GetRank(*item, now)) * item->score;
+    ranked_items.push_back({rank, std::move(item)});
+  }
+
   std::partial_sort(
-      std::begin(items), std::begin(items) + max_results, std::end(items),
-      [this](const std::unique_ptr<CommandItem>& left,
-             const std::unique_ptr<CommandItem>& right) {
-        auto l_rank = (0.5 + this->GetRank(*left.get())) * left->score;
-        auto r_rank = (0.5 + this->GetRank(*right.get())) * right->score;
-        return abs(l_rank - r_rank) < kDoubleComparisonSlop
-                   ? left->title < right->title
-                   : l_rank > r_rank;
+      std::begin(ranked_items), std::begin(ranked_items) + max_results,
+      std::end(ranked_items),
+      [](const RankedItem& left, const RankedItem& right) {
+        return abs(left.rank - right.rank) < kDoubleComparisonSlop
+                   ? left.item->title < right.item->title
+                   : left.rank > right.rank;
       });
+
+  for (size_t i = 0; i < items.size(); ++i) {
+    items[i] = std::move(ranked_items[i].item);
+  }
 }
 
-std::string Ranker::GetId(const CommandItem& item) const {
-  // TODO(fallaciousreasoning): Introduce a more stable id for commands.
-  return base::UTF16ToUTF8(item.title);
+void Ranker::CommitPendingVisits() {
+  commit_timer_.Stop();
+  if (dirty_ids_.empty()) {
+    return;
+  }
+
+  ScopedDictPrefUpdate update(prefs_, prefs::kCommanderFrecencies);
+  for (const auto& id : dirty_ids_) {
+    const auto& frecency = frecencies_[id];
+    auto* entry = update->EnsureDict(base::UTF16ToUTF8(id));
+    entry->Set("visit_count", frecency.visit_count);
+    entry->Set("last_visit", frecency.last_visit.ToJsTime());
+  }
+  dirty_ids_.clear();
 }
 
-std::tuple<int, base::Time> Ranker::GetInfo(const std::string& id) const {
-  auto* entry = prefs_->GetDict(prefs::kCommanderFrecencies).FindDict(id);
-  if (!entry) {
-    return std::make_tuple(0, base::Time::Min());
+void Ranker::LoadFrecencies() {
+  if (frecencies_loaded_) {
+    return;
   }
+  frecencies_loaded_ = true;
 
-  auto visit_count = entry->FindInt("visit_count").value_or(0);
-  auto last_visit =
-      base::Time::FromJsTime(entry->FindDouble("last_visit").value_or(0));
-  return std::make_tuple(visit_count, last_visit);
+  std::vector<std::pair<CommandId, Frecency>> frecencies;
+  for (const auto [id, value] : prefs_->GetDict(prefs::kCommanderFrecencies)) {
+    const auto* entry = value.GetIfDict();
+    if (!entry) {
+      continue;
+    }
+    Frecency frecency;
+    frecency.visit_count = entry->FindInt("visit_count").value_or(0);
+    frecency.last_visit =
+        base::Time::FromJsTime(entry->FindDouble("last_visit").value_or(0));
+    frecencies.emplace_back(base::UTF8ToUTF16(id), frecency);
+  }
+  frecencies_ = base::flat_map<CommandId, Frecency>(std::move(frecencies));
 }
 
 }  // namespace commander
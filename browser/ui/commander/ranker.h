@@ -8,15 +8,20 @@
 
 #include <memory>
 #include <string>
-#include <tuple>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/ui/commander/command_source.h"
 #include "components/prefs/pref_service.h"
 
 namespace commander {
 
+// Ranks commands by their match score weighted by how often and how recently
+// they were picked. Visits are kept in memory, loaded from
+// kCommanderFrecencies on first use and written back shortly after a visit.
 class Ranker {
  public:
   explicit Ranker(PrefService* prefs);
@@ -30,11 +35,28 @@ class Ranker {
   void Rank(std::vector<std::unique_ptr<CommandItem>>& items,
             size_t max_results);
 
+  // Writes visits that haven't been saved yet to prefs.
+  void CommitPendingVisits();
+
  private:
-  std::string GetId(const CommandItem& item) const;
-  std::tuple<int, base::Time> GetInfo(const std::string& id) const;
+  struct Frecency {
+    int visit_count = 0;
+    base::Time last_visit = base::Time::Min();
+  };
+
+  // Commands are identified by their title.
+  // TODO(fallaciousreasoning): Introduce a more stable id for commands.
+  using CommandId = std::u16string;
+
+  void LoadFrecencies();
+  double GetRank(const CommandItem& item, base::Time now);
 
   raw_ptr<PrefService> prefs_;
+  bool frecencies_loaded_ = false;
+  base::flat_map<CommandId, Frecency> frecencies_;
+  // Visited since the last commit.
+  base::flat_set<CommandId> dirty_ids_;
+  base::OneShotTimer commit_timer_;
 };
 
 }  // namespace commander
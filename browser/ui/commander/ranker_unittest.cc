@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
 #include "brave/components/commander/common/pref_names.h"
 #include "chrome/browser/ui/commander/command_source.h"
 #include "components/prefs/pref_registry_simple.h"
@@ -26,6 +28,8 @@ class RankerUnitTest : public testing::Test {
   }
 
  protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   TestingPrefServiceSimple prefs_;
   commander::Ranker ranker_;
 };
@@ -99,3 +103,52 @@ TEST_F(RankerUnitTest, ScoreIsWeightedByVisits) {
   EXPECT_EQ(u"B", items[1]->title);
   EXPECT_EQ(u"C", items[2]->title);
 }
+
+TEST_F(RankerUnitTest, VisitsAreSavedLazily) {
+  commander::CommandItem item;
+  item.title = u"A";
+  ranker_.Visit(item);
+  ranker_.Visit(item);
+  EXPECT_TRUE(prefs_.GetDict(commander::prefs::kCommanderFrecencies).empty());
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  const auto* entry =
+      prefs_.GetDict(commander::prefs::kCommanderFrecencies).FindDict("A");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(2, entry->FindInt("visit_count"));
+
+  // Another ranker picks up the saved visits.
+  commander::Ranker other_ranker(&prefs_);
+  commander::CommandItem unvisited;
+  unvisited.title = u"B";
+  EXPECT_LT(other_ranker.GetRank(unvisited), other_ranker.GetRank(item));
+}
+
+TEST_F(RankerUnitTest, CommitPendingVisits) {
+  commander::CommandItem item;
+  item.title = u"A";
+  ranker_.Visit(item);
+  ranker_.CommitPendingVisits();
+  EXPECT_TRUE(
+      prefs_.GetDict(commander::prefs::kCommanderFrecencies).FindDict("A"));
+}
+
+TEST_F(RankerUnitTest, RanksManyCommands) {
+  std::vector<std::unique_ptr<commander::CommandItem>> items;
+  for (int i = 0; i < 5000; ++i) {
+    auto item = std::make_unique<commander::CommandItem>();
+    item->title = base::NumberToString16(i);
+    item->score = i % 1000;
+    items.push_back(std::move(item));
+  }
+
+  ranker_.Rank(items, 8);
+  ASSERT_EQ(5000u, items.size());
+  // Ties are broken alphabetically.
+  EXPECT_EQ(u"1999", items[0]->title);
+  EXPECT_EQ(u"2999", items[1]->title);
+  EXPECT_EQ(u"3999", items[2]->title);
+  EXPECT_EQ(u"4999", items[3]->title);
+  EXPECT_EQ(u"999", items[4]->title);
+  EXPECT_EQ(u"1998", items[5]->title);
+}
@@ -0,0 +1,274 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "content/public/browser/web_ui_url_loader_factory.h"
+
+#include <cinttypes>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/functional/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
+#include "base/task/thread_pool.h"
+#include "content/browser/webui/url_data_manager_backend.h"
+#include "content/browser/webui/url_data_source_impl.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/url_data_source.h"
+#include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/data_pipe_producer.h"
+#include "mojo/public/cpp/system/file_data_source.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_byte_range.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/parsed_headers.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/self_deleting_url_loader_factory.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/mojom/url_loader.mojom.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+#define CreateWebUIURLLoaderFactory CreateWebUIURLLoaderFactory_ChromiumImpl
+
+#include "src/content/browser/webui/web_ui_url_loader_factory.cc"
+
+#undef CreateWebUIURLLoaderFactory
+
+namespace content {
+
+namespace {
+
+// Capacity of the pipe a file is streamed through. The producer only reads as
+// much of the file as fits in the pipe, so this also bounds the read-ahead.
+constexpr uint32_t kFileStreamPipeCapacity = 512 * 1024;
+
+struct StreamingFile {
+  base::File file;
+  int64_t length = -1;
+};
+
+StreamingFile OpenFileForStreaming(const base::FilePath& path) {
+  StreamingFile result;
+  result.file.Initialize(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (result.file.IsValid()) {
+    result.length = result.file.GetLength();
+  }
+  return result;
+}
+
+void OnFileStreamed(std::unique_ptr<mojo::DataPipeProducer> producer,
+                    mojo::Remote<network::mojom::URLLoaderClient> client,
+                    int64_t length,
+                    MojoResult result) {
+  network::URLLoaderCompletionStatus status(
+      result == MOJO_RESULT_OK ? net::OK : net::ERR_FAILED);
+  status.encoded_data_length = length;
+  status.encoded_body_length = length;
+  status.decoded_body_length = length;
+  client->OnComplete(status);
+}
+
+void OnFileOpenedForStreaming(
+    const GURL& url,
+    network::mojom::URLResponseHeadPtr head,
+    absl::optional<net::HttpByteRange> range,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> pending_client,
+    StreamingFile streaming_file) {
+  mojo::Remote<network::mojom::URLLoaderClient> client(
+      std::move(pending_client));
+  if (!streaming_file.file.IsValid() || streaming_file.length < 0) {
+    client->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_FILE_NOT_FOUND));
+    return;
+  }
+
+  int64_t first_byte = 0;
+  int64_t length = streaming_file.length;
+  head->headers->SetHeader("Accept-Ranges", "bytes");
+  if (range) {
+    if (!range->ComputeBounds(streaming_file.length)) {
+      client->OnComplete(network::URLLoaderCompletionStatus(
+          net::ERR_REQUEST_RANGE_NOT_SATISFIABLE));
+      return;
+    }
+    first_byte = range->first_byte_position();
+    length = range->last_byte_position() - first_byte + 1;
+    head->headers->ReplaceStatusLine("HTTP/1.1 206 Partial Content");
+    head->headers->SetHeader(
+        "Content-Range",
+        base::StringPrintf("bytes %" PRId64 "-%" PRId64 "/%" PRId64, first_byte,
+                           range->last_byte_position(),
+                           streaming_file.length));
+  }
+  head->headers->SetHeader(net::HttpRequestHeaders::kContentLength,
+                           base::NumberToString(length));
+  head->content_length = length;
+  head->parsed_headers =
+      network::PopulateParsedHeaders(head->headers.get(), url);
+
+  mojo::ScopedDataPipeProducerHandle producer_handle;
+  mojo::ScopedDataPipeConsumerHandle consumer_handle;
+  if (mojo::CreateDataPipe(kFileStreamPipeCapacity, producer_handle,
+                           consumer_handle) != MOJO_RESULT_OK) {
+    client->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
+    return;
+  }
+  client->OnReceiveResponse(std::move(head), std::move(consumer_handle),
+                            absl::nullopt);
+
+  auto data_source =
+      std::make_unique<mojo::FileDataSource>(std::move(streaming_file.file));
+  data_source->SetRange(first_byte, first_byte + length);
+  auto producer =
+      std::make_unique<mojo::DataPipeProducer>(std::move(producer_handle));
+  auto* producer_ptr = producer.get();
+  producer_ptr->Write(std::move(data_source),
+                      base::BindOnce(&OnFileStreamed, std::move(producer),
+                                     std::move(client), length));
+}
+
+// Sits in front of the WebUI URL loader factory and serves requests whose
+// data source is backed by a file on disk (see
+// URLDataSource::GetFilePathForStreaming()) straight from that file. All
+// other requests are forwarded unchanged.
+class StreamingWebUIURLLoaderFactory
+    : public network::SelfDeletingURLLoaderFactory {
+ public:
+  StreamingWebUIURLLoaderFactory(
+      RenderFrameHost* render_frame_host,
+      const std::string& scheme,
+      base::flat_set<std::string> allowed_hosts,
+      mojo::PendingRemote<network::mojom::URLLoaderFactory> chromium_factory,
+      mojo::PendingReceiver<network::mojom::URLLoaderFactory> receiver)
+      : network::SelfDeletingURLLoaderFactory(std::move(receiver)),
+        render_frame_host_id_(render_frame_host->GetGlobalId()),
+        scheme_(scheme),
+        allowed_hosts_(std::move(allowed_hosts)),
+        chromium_factory_(std::move(chromium_factory)) {}
+
+  StreamingWebUIURLLoaderFactory(const StreamingWebUIURLLoaderFactory&) =
+      delete;
+  StreamingWebUIURLLoaderFactory& operator=(
+      const StreamingWebUIURLLoaderFactory&) = delete;
+
+ private:
+  ~StreamingWebUIURLLoaderFactory() override = default;
+
+  // network::mojom::URLLoaderFactory:
+  void CreateLoaderAndStart(
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation)
+      override {
+    DCHECK_CURRENTLY_ON(BrowserThread::UI);
+    if (MaybeStartStreaming(request, client)) {
+      return;
+    }
+    chromium_factory_->CreateLoaderAndStart(
+        std::move(loader), request_id, options, request, std::move(client),
+        traffic_annotation);
+  }
+
+  // Takes |client| and returns true if |request| is served from a file.
+  bool MaybeStartStreaming(
+      const network::ResourceRequest& request,
+      mojo::PendingRemote<network::mojom::URLLoaderClient>& client) {
+    if (request.method != net::HttpRequestHeaders::kGetMethod ||
+        !request.url.SchemeIs(scheme_) ||
+        !URLDataManagerBackend::CheckURLIsValid(request.url)) {
+      return false;
+    }
+    if (!allowed_hosts_.empty() &&
+        !allowed_hosts_.contains(request.url.host())) {
+      return false;
+    }
+
+    auto* render_frame_host = RenderFrameHost::FromID(render_frame_host_id_);
+    if (!render_frame_host) {
+      return false;
+    }
+    auto* browser_context = render_frame_host->GetBrowserContext();
+    URLDataSourceImpl* source =
+        URLDataManagerBackend::GetForBrowserContext(browser_context)
+            ->GetDataSourceFromURL(request.url);
+    base::FilePath path;
+    if (!source ||
+        !source->source()->ShouldServiceRequest(
+            request.url, browser_context,
+            render_frame_host->GetProcess()->GetID()) ||
+        !source->source()->GetFilePathForStreaming(request.url, &path)) {
+      return false;
+    }
+
+    // A Range header that doesn't parse or asks for several ranges is
+    // ignored and the whole file is served (RFC 9110, section 14.2). Only a
+    // single range that turns out to lie outside the file fails the request.
+    absl::optional<net::HttpByteRange> range;
+    std::string range_header;
+    std::vector<net::HttpByteRange> ranges;
+    if (request.headers.GetHeader(net::HttpRequestHeaders::kRange,
+                                  &range_header) &&
+        net::HttpUtil::ParseRangeHeader(range_header, &ranges) &&
+        ranges.size() == 1) {
+      range = ranges[0];
+    }
+
+    std::string origin_header;
+    request.headers.GetHeader(net::HttpRequestHeaders::kOrigin,
+                              &origin_header);
+    auto head = network::mojom::URLResponseHead::New();
+    head->headers =
+        URLDataManagerBackend::GetHeaders(source, request.url, origin_header);
+    head->mime_type = source->source()->GetMimeType(request.url);
+
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+        base::BindOnce(&OpenFileForStreaming, path),
+        base::BindOnce(&OnFileOpenedForStreaming, request.url, std::move(head),
+                       std::move(range), std::move(client)));
+    return true;
+  }
+
+  const GlobalRenderFrameHostId render_frame_host_id_;
+  const std::string scheme_;
+  const base::flat_set<std::string> allowed_hosts_;
+  mojo::Remote<network::mojom::URLLoaderFactory> chromium_factory_;
+};
+
+}  // namespace
+
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+CreateWebUIURLLoaderFactory(RenderFrameHost* render_frame_host,
+                            const std::string& scheme,
+                            base::flat_set<std::string> allowed_webui_hosts) {
+  auto chromium_factory = CreateWebUIURLLoaderFactory_ChromiumImpl(
+      render_frame_host, scheme, allowed_webui_hosts);
+
+  mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote;
+  // The factory deletes itself when its last receiver disconnects.
+  new StreamingWebUIURLLoaderFactory(
+      render_frame_host, scheme, std::move(allowed_webui_hosts),
+      std::move(chromium_factory),
+      pending_remote.InitWithNewPipeAndPassReceiver());
+  return pending_remote;
+}
+
+}  // namespace content
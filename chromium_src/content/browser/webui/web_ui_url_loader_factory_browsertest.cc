@@ -0,0 +1,188 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/threading/thread_restrictions.h"
+#include "chrome/browser/profiles/profile.h"
+#include "chrome/browser/ui/browser.h"
+#include "chrome/browser/ui/tabs/tab_strip_model.h"
+#include "chrome/test/base/in_process_browser_test.h"
+#include "content/public/browser/url_data_source.h"
+#include "content/public/browser/web_contents.h"
+#include "content/public/browser/web_ui_url_loader_factory.h"
+#include "content/public/common/url_constants.h"
+#include "content/public/test/browser_test.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe_utils.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/mojom/url_loader.mojom.h"
+#include "services/network/public/mojom/url_loader_factory.mojom.h"
+#include "services/network/test/test_url_loader_client.h"
+#include "url/gurl.h"
+
+// Tests the streaming of files that a URLDataSource maps through
+// GetFilePathForStreaming(), which the WebUI URL loader factory override adds.
+
+namespace {
+
+constexpr char kFileContents[] = "0123456789";
+
+// Serves chrome-untrusted://streaming-test/media from a file and everything
+// else through StartDataRequest().
+class StreamingTestDataSource : public content::URLDataSource {
+ public:
+  explicit StreamingTestDataSource(const base::FilePath& path) : path_(path) {}
+
+  // content::URLDataSource:
+  std::string GetSource() override {
+    return "chrome-untrusted://streaming-test/";
+  }
+  void StartDataRequest(const GURL& url,
+                        const content::WebContents::Getter& wc_getter,
+                        GotDataCallback callback) override {
+    std::move(callback).Run(
+        base::MakeRefCounted<base::RefCountedString>(std::string("buffered")));
+  }
+  std::string GetMimeType(const GURL& url) override { return "video/mp4"; }
+  bool GetFilePathForStreaming(const GURL& url, base::FilePath* path) override {
+    if (URLToRequestPath(url) != "media") {
+      return false;
+    }
+    *path = path_;
+    return true;
+  }
+
+ private:
+  const base::FilePath path_;
+};
+
+struct Response {
+  int net_error = net::OK;
+  int response_code = 0;
+  std::string content_range;
+  std::string body;
+};
+
+}  // namespace
+
+class WebUIURLLoaderFactoryStreamingBrowserTest : public InProcessBrowserTest {
+ public:
+  void SetUpOnMainThread() override {
+    InProcessBrowserTest::SetUpOnMainThread();
+    {
+      base::ScopedAllowBlockingForTesting allow_blocking;
+      ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+      file_path_ = temp_dir_.GetPath().AppendASCII("media.mp4");
+      ASSERT_TRUE(base::WriteFile(file_path_, kFileContents));
+    }
+    content::URLDataSource::Add(
+        browser()->profile(),
+        std::make_unique<StreamingTestDataSource>(file_path_));
+  }
+
+  // Fetches |path| from the test data source, with |range| as the Range
+  // header unless it is empty.
+  Response Fetch(const std::string& path, const std::string& range) {
+    content::WebContents* web_contents =
+        browser()->tab_strip_model()->GetActiveWebContents();
+    mojo::Remote<network::mojom::URLLoaderFactory> factory(
+        content::CreateWebUIURLLoaderFactory(
+            web_contents->GetPrimaryMainFrame(),
+            content::kChromeUIUntrustedScheme, {}));
+
+    network::ResourceRequest request;
+    request.url = GURL("chrome-untrusted://streaming-test/" + path);
+    request.method = net::HttpRequestHeaders::kGetMethod;
+    if (!range.empty()) {
+      request.headers.SetHeader(net::HttpRequestHeaders::kRange, range);
+    }
+
+    network::TestURLLoaderClient client;
+    mojo::PendingRemote<network::mojom::URLLoader> loader;
+    factory->CreateLoaderAndStart(
+        loader.InitWithNewPipeAndPassReceiver(), 0, 0, request,
+        client.CreateRemote(),
+        net::MutableNetworkTrafficAnnotationTag(TRAFFIC_ANNOTATION_FOR_TESTS));
+    client.RunUntilComplete();
+
+    Response response;
+    response.net_error = client.completion_status().error_code;
+    if (response.net_error != net::OK) {
+      return response;
+    }
+    response.response_code = client.response_head()->headers->response_code();
+    client.response_head()->headers->GetNormalizedHeader(
+        "Content-Range", &response.content_range);
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    EXPECT_TRUE(mojo::BlockingCopyToString(client.response_body_release(),
+                                           &response.body));
+    return response;
+  }
+
+ private:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath file_path_;
+};
+
+IN_PROC_BROWSER_TEST_F(WebUIURLLoaderFactoryStreamingBrowserTest, WholeFile) {
+  const Response response = Fetch("media", "");
+  EXPECT_EQ(net::OK, response.net_error);
+  EXPECT_EQ(200, response.response_code);
+  EXPECT_EQ("", response.content_range);
+  EXPECT_EQ(kFileContents, response.body);
+}
+
+IN_PROC_BROWSER_TEST_F(WebUIURLLoaderFactoryStreamingBrowserTest, SingleRange) {
+  const Response response = Fetch("media", "bytes=2-5");
+  EXPECT_EQ(net::OK, response.net_error);
+  EXPECT_EQ(206, response.response_code);
+  EXPECT_EQ("bytes 2-5/10", response.content_range);
+  EXPECT_EQ("2345", response.body);
+}
+
+IN_PROC_BROWSER_TEST_F(WebUIURLLoaderFactoryStreamingBrowserTest, SuffixRange) {
+  const Response response = Fetch("media", "bytes=-3");
+  EXPECT_EQ(net::OK, response.net_error);
+  EXPECT_EQ(206, response.response_code);
+  EXPECT_EQ("bytes 7-9/10", response.content_range);
+  EXPECT_EQ("789", response.body);
+}
+
+IN_PROC_BROWSER_TEST_F(WebUIURLLoaderFactoryStreamingBrowserTest,
+                       RangePastEnd) {
+  EXPECT_EQ(net::ERR_REQUEST_RANGE_NOT_SATISFIABLE,
+            Fetch("media", "bytes=20-").net_error);
+}
+
+IN_PROC_BROWSER_TEST_F(WebUIURLLoaderFactoryStreamingBrowserTest,
+                       IgnoresUnsupportedRanges) {
+  for (const char* range : {"bytes=abc", "items=0-1", "bytes=0-1,4-5"}) {
+    SCOPED_TRACE(range);
+    const Response response = Fetch("media", range);
+    EXPECT_EQ(net::OK, response.net_error);
+    EXPECT_EQ(200, response.response_code);
+    EXPECT_EQ("", response.content_range);
+    EXPECT_EQ(kFileContents, response.body);
+  }
+}
+
+IN_PROC_BROWSER_TEST_F(WebUIURLLoaderFactoryStreamingBrowserTest,
+                       OtherPathsAreNotStreamed) {
+  const Response response = Fetch("thumbnail", "");
+  EXPECT_EQ(net::OK, response.net_error);
+  EXPECT_EQ("buffered", response.body);
+}
@@ -0,0 +1,15 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "src/content/public/browser/url_data_source.cc"
+
+namespace content {
+
+bool URLDataSource::GetFilePathForStreaming(const GURL& url,
+                                            base::FilePath* path) {
+  return false;
+}
+
+}  // namespace content
@@ -0,0 +1,26 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_CHROMIUM_SRC_CONTENT_PUBLIC_BROWSER_URL_DATA_SOURCE_H_
+#define BRAVE_CHROMIUM_SRC_CONTENT_PUBLIC_BROWSER_URL_DATA_SOURCE_H_
+
+namespace base {
+class FilePath;
+}  // namespace base
+
+// Adds URLDataSource::GetFilePathForStreaming(). A source returns true and
+// fills |path| when |url| is backed by a file on disk; the WebUI URL loader
+// factory then streams that file through a data pipe, honoring Range requests,
+// instead of calling StartDataRequest() and buffering the whole response.
+// Called on the UI thread.
+#define AllowCaching                                              \
+  GetFilePathForStreaming(const GURL& url, base::FilePath* path); \
+  virtual bool AllowCaching
+
+#include "src/content/public/browser/url_data_source.h"  // IWYU pragma: export
+
+#undef AllowCaching
+
+#endif  // BRAVE_CHROMIUM_SRC_CONTENT_PUBLIC_BROWSER_URL_DATA_SOURCE_H_
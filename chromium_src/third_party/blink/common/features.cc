@@ -85,6 +85,12 @@ BASE_FEATURE(kBraveBlockScreenFingerprinting,
              "BraveBlockScreenFingerprinting",
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+// Derives the canvas farbling key with SipHash instead of HMAC-SHA256. Faster
+// on large canvases, but farbles them differently than the default.
+BASE_FEATURE(kBraveCanvasFarblingSipHash,
+             "BraveCanvasFarblingSipHash",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 // Enables protection against fingerprinting via high-resolution time stamps.
 BASE_FEATURE(kBraveRoundTimeStamps,
              "BraveRoundTimeStamps",
@@ -11,6 +11,7 @@
 
 #include "base/containers/contains.h"
 #include "base/strings/strcat.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/ai_chat/ai_chat.mojom-shared.h"
 #include "brave/components/ai_chat/constants.h"
@@ -129,21 +130,12 @@ const std::vector<ConversationTurn>& AIChatTabHelper::GetConversationHistory() {
 }
 
 const std::string& AIChatTabHelper::GetConversationHistoryString() {
-  std::vector<std::string> turn_strings;
-  for (const ConversationTurn& turn : chat_history_) {
-    turn_strings.push_back((turn.character_type == CharacterType::HUMAN
-                                ? ai_chat::kHumanPromptPlaceholder
-                                : ai_chat::kAIPromptPlaceholder) +
-                           turn.text);
-  }
-
-  history_text_ = base::JoinString(turn_strings, "");
-
-  return history_text_;
+  return history_prompt_builder_.text();
 }
 
 void AIChatTabHelper::AddToConversationHistory(const ConversationTurn& turn) {
   chat_history_.push_back(turn);
+  history_prompt_builder_.AppendTurn(turn);
 
   for (auto& obs : observers_) {
     obs.OnHistoryUpdate();
@@ -159,6 +151,7 @@ void AIChatTabHelper::UpdateOrCreateLastAssistantEntry(
                               updated_text});
   } else {
     chat_history_.back().text = updated_text;
+    history_prompt_builder_.ReplaceLastTurn(chat_history_.back());
   }
 
   // Trigger an observer update to refresh the UI.
@@ -196,6 +189,12 @@ void AIChatTabHelper::RequestSummary() {
     return;
   }
 
+  if (!article_text_.empty()) {
+    VLOG(1) << __func__ << " Article text is in cache\n";
+    RequestSummaryOfArticleText();
+    return;
+  }
+
   auto* primary_rfh = web_contents()->GetPrimaryMainFrame();
 
   if (!primary_rfh) {
@@ -262,8 +261,9 @@ void AIChatTabHelper::DistillViaAlgorithm(const ui::AXTree& tree) {
   // TODO(nullhook): The assumption here is that 9300 chars equate to
   // approximately 2k tokens, which is a rough estimate. A proper tokenizer is
   // needed for accurate measurement.
-  std::string contents_text = base::UTF16ToUTF8(
-      base::JoinString(text_node_contents, u" ").substr(0, 9300));
+  // Prevent indirect prompt injections being sent to the AI model.
+  std::string contents_text = ai_chat::SanitizePromptText(base::UTF16ToUTF8(
+      base::JoinString(text_node_contents, u" ").substr(0, 9300)));
   if (contents_text.empty()) {
     VLOG(1) << __func__ << " Contents is empty\n";
 
@@ -273,23 +273,19 @@ void AIChatTabHelper::DistillViaAlgorithm(const ui::AXTree& tree) {
     return;
   }
 
-  // Prevent indirect prompt injections being sent to the AI model.
-  // TODO(nullhook): Abstract prompt injection cleanups to a central place
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, ai_chat::kHumanPrompt,
-                                     "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, ai_chat::kAIPrompt, "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, "<article>", "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, "</article>", "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, "<history>", "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, "</history>", "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, "<question>", "");
-  base::ReplaceSubstringsAfterOffset(&contents_text, 0, "</question>", "");
-
   VLOG(1) << __func__
           << " Number of chars in content text = " << contents_text.length()
           << "\n";
 
-  article_text_ = contents_text;
+  // Kept until the primary page changes, so that summarizing the same page
+  // again doesn't need another snapshot.
+  article_text_ = std::move(contents_text);
+
+  RequestSummaryOfArticleText();
+}
+
+void AIChatTabHelper::RequestSummaryOfArticleText() {
+  DCHECK(!article_text_.empty());
 
   std::string summarize_prompt = "Summarize the above article.";
 
@@ -301,6 +297,7 @@ void AIChatTabHelper::DistillViaAlgorithm(const ui::AXTree& tree) {
 
 void AIChatTabHelper::CleanUp() {
   chat_history_.clear();
+  history_prompt_builder_.Clear();
   article_summary_.clear();
   article_text_.clear();
   is_request_in_progress_ = false;
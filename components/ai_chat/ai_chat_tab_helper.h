@@ -13,6 +13,7 @@
 #include "base/observer_list.h"
 #include "brave/components/ai_chat/ai_chat.mojom.h"
 #include "brave/components/ai_chat/ai_chat_api.h"
+#include "brave/components/ai_chat/prompt_builder.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -61,6 +62,7 @@ class AIChatTabHelper : public content::WebContentsObserver,
   const std::string& GetConversationHistoryString();
   void OnSnapshotFinished(const ui::AXTreeUpdate& result);
   void DistillViaAlgorithm(const ui::AXTree& tree);
+  void RequestSummaryOfArticleText();
   void SetArticleSummaryString(const std::string& text);
   void CleanUp();
   void OnAPIStreamDataReceived(data_decoder::DataDecoder::ValueOrError result);
@@ -77,8 +79,9 @@ class AIChatTabHelper : public content::WebContentsObserver,
 
   // TODO(nullhook): Abstract the data model
   std::vector<ai_chat::mojom::ConversationTurn> chat_history_;
+  // Distilled text of the primary page, cleared when it changes.
   std::string article_text_;
-  std::string history_text_;
+  ai_chat::ConversationHistoryPromptBuilder history_prompt_builder_;
   std::string article_summary_;
 
   bool is_request_in_progress_ = false;
@@ -0,0 +1,146 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ai_chat/prompt_builder.h"
+
+#include <stdint.h>
+
+#include <array>
+#include <queue>
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/no_destructor.h"
+#include "base/strings/strcat.h"
+#include "brave/components/ai_chat/constants.h"
+
+namespace ai_chat {
+
+namespace {
+
+// Aho-Corasick automaton over the prompt markers, expanded into a full
+// transition table so that matching costs one lookup per input byte.
+class MarkerMatcher {
+ public:
+  MarkerMatcher() {
+    const char* const kMarkers[] = {
+        kHumanPrompt, kAIPrompt,    "<article>",  "</article>",
+        "<history>",  "</history>", "<question>", "</question>",
+    };
+
+    nodes_.emplace_back();
+    for (const char* marker : kMarkers) {
+      size_t state = 0;
+      size_t length = 0;
+      for (const char* c = marker; *c; ++c, ++length) {
+        const uint8_t byte = static_cast<uint8_t>(*c);
+        if (!nodes_[state].next[byte]) {
+          nodes_[state].next[byte] = static_cast<uint16_t>(nodes_.size());
+          nodes_.emplace_back();
+        }
+        state = nodes_[state].next[byte];
+      }
+      nodes_[state].match_length = length;
+    }
+
+    // Breadth-first, fill in the missing transitions from each state's
+    // failure state, which is always closer to the root.
+    std::vector<uint16_t> fail(nodes_.size(), 0);
+    std::queue<uint16_t> queue;
+    for (auto& child : nodes_[0].next) {
+      if (child) {
+        queue.push(child);
+      }
+    }
+    while (!queue.empty()) {
+      const uint16_t state = queue.front();
+      queue.pop();
+      Node& node = nodes_[state];
+      if (!node.match_length) {
+        node.match_length = nodes_[fail[state]].match_length;
+      }
+      for (size_t byte = 0; byte < node.next.size(); ++byte) {
+        const uint16_t fail_next = nodes_[fail[state]].next[byte];
+        if (node.next[byte]) {
+          fail[node.next[byte]] = fail_next;
+          queue.push(node.next[byte]);
+        } else {
+          node.next[byte] = fail_next;
+        }
+      }
+    }
+  }
+
+  MarkerMatcher(const MarkerMatcher&) = delete;
+  MarkerMatcher& operator=(const MarkerMatcher&) = delete;
+
+  std::string Sanitize(const std::string& text) const {
+    std::string output;
+    output.reserve(text.size());
+    // |states[i]| is the automaton state after reading |output[0, i)|, so
+    // that matching can resume from the right state when a marker is cut.
+    std::vector<uint16_t> states;
+    states.reserve(text.size() + 1);
+    states.push_back(0);
+
+    for (const char c : text) {
+      const uint16_t state =
+          nodes_[states.back()].next[static_cast<uint8_t>(c)];
+      output.push_back(c);
+      states.push_back(state);
+
+      const size_t match_length = nodes_[state].match_length;
+      if (match_length) {
+        DCHECK_LE(match_length, output.size());
+        output.resize(output.size() - match_length);
+        states.resize(states.size() - match_length);
+      }
+    }
+    return output;
+  }
+
+ private:
+  struct Node {
+    std::array<uint16_t, 256> next = {};
+    // Length of the longest marker ending at this state, or 0.
+    size_t match_length = 0;
+  };
+
+  std::vector<Node> nodes_;
+};
+
+}  // namespace
+
+ConversationHistoryPromptBuilder::ConversationHistoryPromptBuilder() = default;
+
+ConversationHistoryPromptBuilder::~ConversationHistoryPromptBuilder() = default;
+
+void ConversationHistoryPromptBuilder::AppendTurn(
+    const mojom::ConversationTurn& turn) {
+  last_turn_offset_ = text_.size();
+  base::StrAppend(&text_,
+                  {turn.character_type == mojom::CharacterType::HUMAN
+                       ? kHumanPromptPlaceholder
+                       : kAIPromptPlaceholder,
+                   turn.text});
+}
+
+void ConversationHistoryPromptBuilder::ReplaceLastTurn(
+    const mojom::ConversationTurn& turn) {
+  text_.resize(last_turn_offset_);
+  AppendTurn(turn);
+}
+
+void ConversationHistoryPromptBuilder::Clear() {
+  text_.clear();
+  last_turn_offset_ = 0;
+}
+
+std::string SanitizePromptText(const std::string& text) {
+  static const base::NoDestructor<MarkerMatcher> matcher;
+  return matcher->Sanitize(text);
+}
+
+}  // namespace ai_chat
@@ -0,0 +1,50 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_AI_CHAT_PROMPT_BUILDER_H_
+#define BRAVE_COMPONENTS_AI_CHAT_PROMPT_BUILDER_H_
+
+#include <string>
+
+#include "brave/components/ai_chat/ai_chat.mojom.h"
+
+namespace ai_chat {
+
+// Builds the conversation history part of the prompt. Turns are appended to
+// the string as they are added rather than the whole history being joined
+// again for every request.
+class ConversationHistoryPromptBuilder {
+ public:
+  ConversationHistoryPromptBuilder();
+  ~ConversationHistoryPromptBuilder();
+
+  ConversationHistoryPromptBuilder(const ConversationHistoryPromptBuilder&) =
+      delete;
+  ConversationHistoryPromptBuilder& operator=(
+      const ConversationHistoryPromptBuilder&) = delete;
+
+  void AppendTurn(const mojom::ConversationTurn& turn);
+  // Replaces the last appended turn, e.g. while an assistant response is
+  // being streamed in.
+  void ReplaceLastTurn(const mojom::ConversationTurn& turn);
+  void Clear();
+
+  const std::string& text() const { return text_; }
+
+ private:
+  std::string text_;
+  // Where the last appended turn starts in |text_|.
+  size_t last_turn_offset_ = 0;
+};
+
+// Removes the markers the prompt is built from (such as "Human:" or
+// "<article>") from |text| in a single pass, so that page content can't
+// inject turns into the conversation. Text that forms a marker once an inner
+// marker has been removed is removed as well.
+std::string SanitizePromptText(const std::string& text);
+
+}  // namespace ai_chat
+
+#endif  // BRAVE_COMPONENTS_AI_CHAT_PROMPT_BUILDER_H_
@@ -0,0 +1,94 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ai_chat/prompt_builder.h"
+
+#include <string>
+
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/components/ai_chat/constants.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ai_chat {
+
+namespace {
+
+mojom::ConversationTurn Turn(mojom::CharacterType character_type,
+                             const std::string& text) {
+  return {character_type, mojom::ConversationTurnVisibility::VISIBLE, text};
+}
+
+}  // namespace
+
+TEST(AIChatPromptBuilderTest, ConversationHistory) {
+  ConversationHistoryPromptBuilder builder;
+  EXPECT_EQ("", builder.text());
+
+  builder.AppendTurn(Turn(mojom::CharacterType::HUMAN, "Hi"));
+  builder.AppendTurn(Turn(mojom::CharacterType::ASSISTANT, "Hel"));
+  EXPECT_EQ(base::StrCat({kHumanPromptPlaceholder, "Hi", kAIPromptPlaceholder,
+                          "Hel"}),
+            builder.text());
+
+  builder.ReplaceLastTurn(Turn(mojom::CharacterType::ASSISTANT, "Hello"));
+  EXPECT_EQ(base::StrCat({kHumanPromptPlaceholder, "Hi", kAIPromptPlaceholder,
+                          "Hello"}),
+            builder.text());
+
+  builder.Clear();
+  EXPECT_EQ("", builder.text());
+}
+
+TEST(AIChatPromptBuilderTest, LongConversation) {
+  ConversationHistoryPromptBuilder builder;
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    const std::string question = "Question " + base::NumberToString(i);
+    builder.AppendTurn(Turn(mojom::CharacterType::HUMAN, question));
+    base::StrAppend(&expected, {kHumanPromptPlaceholder, question});
+
+    // Stream the answer in one word at a time.
+    std::string answer;
+    builder.AppendTurn(Turn(mojom::CharacterType::ASSISTANT, answer));
+    for (int word = 0; word < 20; ++word) {
+      base::StrAppend(&answer, {"word", base::NumberToString(word), " "});
+      builder.ReplaceLastTurn(Turn(mojom::CharacterType::ASSISTANT, answer));
+    }
+    base::StrAppend(&expected, {kAIPromptPlaceholder, answer});
+  }
+  EXPECT_EQ(expected, builder.text());
+}
+
+TEST(AIChatPromptBuilderTest, SanitizePromptText) {
+  EXPECT_EQ("", SanitizePromptText(""));
+  EXPECT_EQ("Nothing to remove <art",
+            SanitizePromptText("Nothing to remove <art"));
+  EXPECT_EQ("ab", SanitizePromptText("a<article>b</article>"));
+  EXPECT_EQ("says hi",
+            SanitizePromptText(base::StrCat({kHumanPrompt, "says hi",
+                                             kAIPrompt})));
+  EXPECT_EQ("<history", SanitizePromptText("<history</question>"));
+  EXPECT_EQ("xy", SanitizePromptText("x<question><history></history>y"));
+
+  // Markers that only form once an inner marker has been removed are removed
+  // too.
+  EXPECT_EQ("ab", SanitizePromptText("a<arti<article>cle>b"));
+  EXPECT_EQ("", SanitizePromptText("<</history>/<article>history>"));
+}
+
+TEST(AIChatPromptBuilderTest, SanitizeLongText) {
+  std::string text;
+  std::string expected;
+  for (int i = 0; i < 5000; ++i) {
+    const std::string paragraph =
+        "Paragraph " + base::NumberToString(i) + " of the article.";
+    base::StrAppend(&text, {paragraph, i % 7 ? " " : "<question>"});
+    base::StrAppend(&expected, {paragraph, i % 7 ? " " : ""});
+  }
+  EXPECT_EQ(expected, SanitizePromptText(text));
+}
+
+}  // namespace ai_chat
@@ -10,11 +10,10 @@
 
 #include "base/check.h"
 #include "base/check_op.h"
-#include "base/containers/cxx20_erase_vector.h"
 #include "base/json/json_writer.h"
 #include "base/ranges/algorithm.h"
 #include "base/strings/string_piece.h"
-#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
 #include "net/base/load_flags.h"
 #include "net/http/http_status_code.h"
 #include "services/data_decoder/public/cpp/data_decoder.h"
@@ -309,7 +308,7 @@ void APIRequestHelper::URLLoaderHandler::send_sse_data_for_testing(
     base::StringPiece string_piece,
     bool is_sse,
     DataReceivedCallback callback) {
-  is_sse_ = true;
+  is_sse_ = is_sse;
   data_received_callback_ = std::move(callback);
   OnDataReceived(string_piece, base::BindOnce([]() {}));
 }
@@ -347,6 +346,12 @@ void APIRequestHelper::URLLoaderHandler::OnComplete(bool success) {
   VLOG(1) << "[[" << __func__ << "]]"
           << " Response completed\n";
 
+  if (is_sse_) {
+    std::vector<SSEDecoder::Event> events;
+    sse_decoder_.Finish(&events);
+    QueueSSEEvents(events);
+  }
+
   request_is_finished_ = true;
 
   // Delete now or when decoding operations are complete
@@ -447,54 +452,103 @@ void APIRequestHelper::URLLoaderHandler::ParseSSE(
     base::StringPiece string_piece) {
   // New chunks should only be received before the request is completed
   DCHECK(!request_is_finished_);
-  // We split the string into multiple chunks because there are cases where
-  // multiple chunks are received in a single call.
-  std::vector<base::StringPiece> stream_data = base::SplitStringPiece(
-      string_piece, "\r\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  // A chunk can hold several events, or end in the middle of one. The decoder
+  // keeps the incomplete part until the rest of it arrives.
+  std::vector<SSEDecoder::Event> events;
+  sse_decoder_.Feed(string_piece, &events);
+  QueueSSEEvents(events);
+}
 
-  // Remove SSE events that don't look like JSON - could be string or [DONE]
+void APIRequestHelper::URLLoaderHandler::QueueSSEEvents(
+    const std::vector<SSEDecoder::Event>& events) {
+  // Skip SSE events that don't look like JSON - could be string or [DONE]
   // message.
   // TODO(@nullhook): Parse both JSON and string values. The below currently
   // only identifies JSON values.
-  static constexpr char kDataPrefix[] = "data: {";
-  base::EraseIf(stream_data, [](base::StringPiece item) {
-    DVLOG(3) << "Received chunk: " << item;
-    if (!base::StartsWith(item, kDataPrefix)) {
+  for (const auto& event : events) {
+    DVLOG(3) << "Received event: " << event.type << " " << event.data;
+    if (!base::StartsWith(event.data, "{")) {
       // This is useful to log in case an API starts
       // coming back with unknown data type in some
       // scenarios.
       VLOG(1) << "Data did not start with SSE prefix";
-      return true;
+      continue;
     }
-    return false;
-  });
+    pending_sse_events_.push_back(event.data);
+  }
+  MaybeParsePendingSSEEvents();
+}
 
+void APIRequestHelper::URLLoaderHandler::MaybeParsePendingSSEEvents() {
+  // Only one parse is in flight at a time so that results are delivered in
+  // order, even when a batch has to be parsed again event by event.
+  if (pending_sse_events_.empty() || current_decoding_operation_count_ > 0) {
+    return;
+  }
+
+  std::vector<std::string> events;
+  events.swap(pending_sse_events_);
   // Keep track of number of in-progress data decoding operations
   // so that we can know if any are still in-progress when the request
   // completes.
-  current_decoding_operation_count_ += stream_data.size();
-
-  for (const auto& data : stream_data) {
-    auto json = data.substr(strlen(kDataPrefix) - 1);
-    auto on_json_parsed =
-        [](base::WeakPtr<APIRequestHelper::URLLoaderHandler> handler,
-           data_decoder::DataDecoder::ValueOrError result) {
-          DVLOG(2) << "Chunk parsed";
-          if (!handler) {
-            return;
-          }
-          handler->current_decoding_operation_count_--;
-          DCHECK(handler->data_received_callback_);
-          handler->data_received_callback_.Run(std::move(result));
-          // Parsing is potentially the last operation for |URLLoaderHandler|.
-          handler->MaybeSendResult();
-        };
-
+  current_decoding_operation_count_++;
+  if (events.size() == 1) {
     DVLOG(2) << "Going to call ParseJson";
-    GetDataDecoder()->ParseJson(std::move(json.data()),
-                                base::BindOnce(std::move(on_json_parsed),
-                                               weak_ptr_factory_.GetWeakPtr()));
+    GetDataDecoder()->ParseJson(
+        events.front(),
+        base::BindOnce(&APIRequestHelper::URLLoaderHandler::OnParseSSEEvent,
+                       weak_ptr_factory_.GetWeakPtr()));
+    return;
   }
+
+  DVLOG(2) << "Going to call ParseJson for " << events.size() << " events";
+  std::string batch = "[" + base::JoinString(events, ",") + "]";
+  GetDataDecoder()->ParseJson(
+      batch,
+      base::BindOnce(&APIRequestHelper::URLLoaderHandler::OnParseSSEBatch,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(events)));
+}
+
+void APIRequestHelper::URLLoaderHandler::OnParseSSEBatch(
+    std::vector<std::string> events,
+    data_decoder::DataDecoder::ValueOrError result) {
+  DVLOG(2) << "Batch parsed";
+  current_decoding_operation_count_--;
+  DCHECK(data_received_callback_);
+
+  if (result.has_value() && result->is_list() &&
+      result->GetList().size() == events.size()) {
+    for (auto& value : result->GetList()) {
+      data_received_callback_.Run(std::move(value));
+    }
+  } else {
+    // At least one of the events isn't valid JSON. Parse them one by one so
+    // that the valid ones are still delivered and the others report their
+    // own error.
+    current_decoding_operation_count_ += events.size();
+    for (auto& event : events) {
+      GetDataDecoder()->ParseJson(
+          event,
+          base::BindOnce(&APIRequestHelper::URLLoaderHandler::OnParseSSEEvent,
+                         weak_ptr_factory_.GetWeakPtr()));
+    }
+  }
+
+  MaybeParsePendingSSEEvents();
+  // Parsing is potentially the last operation for |URLLoaderHandler|.
+  MaybeSendResult();
+}
+
+void APIRequestHelper::URLLoaderHandler::OnParseSSEEvent(
+    data_decoder::DataDecoder::ValueOrError result) {
+  DVLOG(2) << "Chunk parsed";
+  current_decoding_operation_count_--;
+  DCHECK(data_received_callback_);
+  data_received_callback_.Run(std::move(result));
+
+  MaybeParsePendingSSEEvents();
+  // Parsing is potentially the last operation for |URLLoaderHandler|.
+  MaybeSendResult();
 }
 
 }  // namespace api_request_helper
@@ -9,6 +9,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/files/file_path.h"
@@ -17,6 +18,7 @@
 #include "base/functional/callback_helpers.h"
 #include "base/time/time.h"
 #include "base/values.h"
+#include "brave/components/api_request_helper/sse_decoder.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "services/data_decoder/public/cpp/data_decoder.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -123,6 +125,14 @@ class APIRequestHelper {
     // then call |APIRequestHelper::Cancel|.
     void MaybeSendResult();
     void ParseSSE(base::StringPiece string_piece);
+    void QueueSSEEvents(const std::vector<SSEDecoder::Event>& events);
+    // Parses the queued JSON events in a single DataDecoder call, unless a
+    // parse is already in progress. Events that arrive meanwhile are batched
+    // into the next call.
+    void MaybeParsePendingSSEEvents();
+    void OnParseSSEBatch(std::vector<std::string> events,
+                         data_decoder::DataDecoder::ValueOrError result);
+    void OnParseSSEEvent(data_decoder::DataDecoder::ValueOrError result);
 
     // network::SimpleURLLoaderStreamConsumer implementation:
     void OnDataReceived(base::StringPiece string_piece,
@@ -147,6 +157,9 @@ class APIRequestHelper {
     ResponseConversionCallback conversion_callback_;
 
     bool is_sse_ = false;
+    SSEDecoder sse_decoder_;
+    // JSON data of SSE events waiting to be parsed.
+    std::vector<std::string> pending_sse_events_;
 
     // To ensure ordered processing of stream chunks, we create our own
     // instance of DataDecoder per request. This avoids the issue
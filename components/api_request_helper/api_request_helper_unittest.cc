@@ -6,9 +6,12 @@
 #include "brave/components/api_request_helper/api_request_helper.h"
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/functional/callback.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/test/bind.h"
 #include "base/test/mock_callback.h"
 #include "base/test/task_environment.h"
@@ -230,7 +233,7 @@ TEST_F(ApiRequestHelperUnitTest, URLLoaderHandlerParsing) {
 TEST_F(ApiRequestHelperUnitTest, SSEJsonParsing) {
   base::RunLoop run_loop;
   SendMessageSSEJSON(
-      "data: {\"completion\": \" Hello there!\", \"stop\": null}",
+      "data: {\"completion\": \" Hello there!\", \"stop\": null}\r\n\r\n",
       base::BindRepeating(
           [](base::RunLoop* run_loop,
              data_decoder::DataDecoder::ValueOrError result) {
@@ -244,7 +247,8 @@ TEST_F(ApiRequestHelperUnitTest, SSEJsonParsing) {
 
   base::RunLoop run_loop2;
   SendMessageSSEJSON(
-      "data: {\"completion\": \" Hello there! How are you?\", \"stop\": null}",
+      "data: {\"completion\": \" Hello there! How are you?\", \"stop\": "
+      "null}\r\n\r\n",
       base::BindRepeating(
           [](base::RunLoop* run_loop,
              data_decoder::DataDecoder::ValueOrError result) {
@@ -260,7 +264,7 @@ TEST_F(ApiRequestHelperUnitTest, SSEJsonParsing) {
   // "[DONE]". We use a run loop to wait for the callback to be called, and
   // we expect it to never be called.
   base::RunLoop run_loop3;
-  SendMessageSSEJSON("data: [DONE]",
+  SendMessageSSEJSON("data: [DONE]\r\n\r\n",
                      base::BindRepeating(
                          [](base::RunLoop* run_loop,
                             data_decoder::DataDecoder::ValueOrError result) {
@@ -281,4 +285,77 @@ TEST_F(ApiRequestHelperUnitTest, SSEJsonParsing) {
   run_loop4.RunUntilIdle();
 }
 
+TEST_F(ApiRequestHelperUnitTest, SSEEventSplitAcrossChunks) {
+  std::vector<std::string> completions;
+  auto callback = base::BindLambdaForTesting(
+      [&](data_decoder::DataDecoder::ValueOrError result) {
+        ASSERT_TRUE(result.has_value());
+        completions.push_back(*result->GetDict().FindString("completion"));
+      });
+
+  // Split inside the JSON, the field name and a CRLF line break.
+  SendMessageSSEJSON("event: completion\r\ndata: {\"completion\": \"Hel",
+                     callback);
+  SendMessageSSEJSON("lo\"}\r", callback);
+  SendMessageSSEJSON("\n\r\nda", callback);
+  SendMessageSSEJSON("ta: {\"completion\": \" there\"}\n\n", callback);
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_EQ(std::vector<std::string>({"Hello", " there"}), completions);
+}
+
+TEST_F(ApiRequestHelperUnitTest, SSEBatchedEventsKeepOrder) {
+  std::vector<std::string> completions;
+  auto callback = base::BindLambdaForTesting(
+      [&](data_decoder::DataDecoder::ValueOrError result) {
+        completions.push_back(result.has_value()
+                                  ? *result->GetDict().FindString("completion")
+                                  : "error");
+      });
+
+  // Events that arrive together are parsed in one batch. An invalid event
+  // only fails itself.
+  SendMessageSSEJSON(
+      "data: {\"completion\": \"a\"}\n\n"
+      "data: {\"completion\": \"b\"}\n\n"
+      "data: {\"completion\": \"c\"\n\n"
+      "data: [DONE]\n\n"
+      "data: {\"completion\": \"d\"}\n\n",
+      callback);
+  SendMessageSSEJSON(
+      "data: {\"completion\": \"e\"}\n\n"
+      "data: {\"completion\": \"f\"}\n\n",
+      callback);
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_EQ(std::vector<std::string>({"a", "b", "error", "d", "e", "f"}),
+            completions);
+}
+
+TEST_F(ApiRequestHelperUnitTest, SSEManySmallChunks) {
+  std::string stream;
+  for (int i = 0; i < 1000; ++i) {
+    stream += ": keep-alive\n";
+    stream += "data: {\"completion\": \"" + base::NumberToString(i) +
+              "\"}\n";
+    stream += "\n";
+  }
+
+  std::vector<std::string> completions;
+  auto callback = base::BindLambdaForTesting(
+      [&](data_decoder::DataDecoder::ValueOrError result) {
+        ASSERT_TRUE(result.has_value());
+        completions.push_back(*result->GetDict().FindString("completion"));
+      });
+  for (size_t i = 0; i < stream.size(); i += 7) {
+    SendMessageSSEJSON(base::StringPiece(stream).substr(i, 7), callback);
+  }
+  base::RunLoop().RunUntilIdle();
+
+  ASSERT_EQ(1000u, completions.size());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(base::NumberToString(i), completions[i]);
+  }
+}
+
 }  // namespace api_request_helper
@@ -0,0 +1,149 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/api_request_helper/sse_decoder.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/logging.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+
+namespace api_request_helper {
+
+namespace {
+
+constexpr char kByteOrderMark[] = "\xEF\xBB\xBF";
+
+}  // namespace
+
+SSEDecoder::Event::Event() = default;
+SSEDecoder::Event::Event(const Event&) = default;
+SSEDecoder::Event::Event(Event&&) = default;
+SSEDecoder::Event& SSEDecoder::Event::operator=(const Event&) = default;
+SSEDecoder::Event& SSEDecoder::Event::operator=(Event&&) = default;
+SSEDecoder::Event::~Event() = default;
+
+SSEDecoder::SSEDecoder() = default;
+
+SSEDecoder::~SSEDecoder() = default;
+
+void SSEDecoder::Feed(base::StringPiece chunk, std::vector<Event>* events) {
+  DCHECK(events);
+  if (skip_leading_lf_ && !chunk.empty()) {
+    if (chunk.front() == '\n') {
+      chunk.remove_prefix(1);
+    }
+    skip_leading_lf_ = false;
+  }
+
+  while (!chunk.empty()) {
+    size_t end = chunk.find_first_of("\r\n");
+    if (end == base::StringPiece::npos) {
+      line_buffer_.append(chunk.data(), chunk.size());
+      return;
+    }
+
+    const base::StringPiece line = chunk.substr(0, end);
+    if (line_buffer_.empty()) {
+      ProcessLine(line, events);
+    } else {
+      line_buffer_.append(line.data(), line.size());
+      ProcessLine(line_buffer_, events);
+      line_buffer_.clear();
+    }
+
+    // Lines end with CRLF, LF or CR.
+    if (chunk[end] == '\r') {
+      if (end + 1 == chunk.size()) {
+        skip_leading_lf_ = true;
+      } else if (chunk[end + 1] == '\n') {
+        ++end;
+      }
+    }
+    chunk.remove_prefix(end + 1);
+  }
+}
+
+void SSEDecoder::Finish(std::vector<Event>* events) {
+  DCHECK(events);
+  if (!line_buffer_.empty()) {
+    ProcessLine(line_buffer_, events);
+    line_buffer_.clear();
+  }
+  DispatchEvent(events);
+  skip_leading_lf_ = false;
+}
+
+void SSEDecoder::ProcessLine(base::StringPiece line,
+                             std::vector<Event>* events) {
+  if (is_first_line_) {
+    is_first_line_ = false;
+    if (base::StartsWith(line, kByteOrderMark)) {
+      line.remove_prefix(sizeof(kByteOrderMark) - 1);
+    }
+  }
+
+  if (line.empty()) {
+    DispatchEvent(events);
+    return;
+  }
+  if (line.front() == ':') {
+    // Comment, usually sent as a keep-alive.
+    return;
+  }
+
+  const size_t colon = line.find(':');
+  const base::StringPiece field = line.substr(0, colon);
+  base::StringPiece value;
+  if (colon != base::StringPiece::npos) {
+    value = line.substr(colon + 1);
+    if (base::StartsWith(value, " ")) {
+      value.remove_prefix(1);
+    }
+  }
+
+  if (field == "event") {
+    event_type_.assign(value.data(), value.size());
+  } else if (field == "data") {
+    data_.append(value.data(), value.size());
+    data_.push_back('\n');
+  } else if (field == "id") {
+    if (value.find('\0') == base::StringPiece::npos) {
+      last_event_id_.assign(value.data(), value.size());
+    }
+  } else if (field == "retry") {
+    uint64_t milliseconds;
+    if (!value.empty() &&
+        base::ranges::all_of(value, base::IsAsciiDigit<char>) &&
+        base::StringToUint64(value, &milliseconds)) {
+      retry_ = base::Milliseconds(milliseconds);
+    }
+  } else {
+    DVLOG(3) << "Ignoring unknown SSE field: " << field;
+  }
+}
+
+void SSEDecoder::DispatchEvent(std::vector<Event>* events) {
+  if (data_.empty()) {
+    event_type_.clear();
+    return;
+  }
+
+  Event event;
+  event.type = event_type_.empty() ? "message" : std::move(event_type_);
+  // Drop the line break appended after the last data line.
+  data_.pop_back();
+  event.data = std::move(data_);
+  event.last_event_id = last_event_id_;
+  events->push_back(std::move(event));
+
+  data_.clear();
+  event_type_.clear();
+}
+
+}  // namespace api_request_helper
@@ -0,0 +1,77 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_API_REQUEST_HELPER_SSE_DECODER_H_
+#define BRAVE_COMPONENTS_API_REQUEST_HELPER_SSE_DECODER_H_
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+#include "base/time/time.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace api_request_helper {
+
+// Incremental parser for a text/event-stream body, following
+// https://html.spec.whatwg.org/multipage/server-sent-events.html#event-stream-interpretation
+//
+// The body can be fed in chunks of any size. Lines (and events) that span
+// chunk boundaries are buffered until they are complete.
+class SSEDecoder {
+ public:
+  struct Event {
+    Event();
+    Event(const Event&);
+    Event(Event&&);
+    Event& operator=(const Event&);
+    Event& operator=(Event&&);
+    ~Event();
+
+    // Value of the "event" field, "message" if there was none.
+    std::string type;
+    std::string data;
+    // Last event id at the time the event was dispatched.
+    std::string last_event_id;
+  };
+
+  SSEDecoder();
+  ~SSEDecoder();
+
+  SSEDecoder(const SSEDecoder&) = delete;
+  SSEDecoder& operator=(const SSEDecoder&) = delete;
+
+  // Parses |chunk| and appends the events it completes to |events|.
+  void Feed(base::StringPiece chunk, std::vector<Event>* events);
+
+  // Call at the end of the stream. Unlike the spec, which drops an event that
+  // isn't followed by a blank line, the last line and event are dispatched
+  // if they have data, since some servers omit the final line break.
+  void Finish(std::vector<Event>* events);
+
+  // Reconnection time from the last valid "retry" field, if any.
+  absl::optional<base::TimeDelta> retry() const { return retry_; }
+
+ private:
+  void ProcessLine(base::StringPiece line, std::vector<Event>* events);
+  void DispatchEvent(std::vector<Event>* events);
+
+  // Unterminated line carried over from the previous chunk.
+  std::string line_buffer_;
+  // The previous chunk ended with CR, so a leading LF in the next one
+  // belongs to the same line break.
+  bool skip_leading_lf_ = false;
+  // A byte order mark is only allowed at the start of the stream.
+  bool is_first_line_ = true;
+
+  std::string data_;
+  std::string event_type_;
+  std::string last_event_id_;
+  absl::optional<base::TimeDelta> retry_;
+};
+
+}  // namespace api_request_helper
+
+#endif  // BRAVE_COMPONENTS_API_REQUEST_HELPER_SSE_DECODER_H_
@@ -0,0 +1,106 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/api_request_helper/sse_decoder.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace api_request_helper {
+
+namespace {
+
+std::vector<SSEDecoder::Event> Decode(const std::vector<std::string>& chunks) {
+  SSEDecoder decoder;
+  std::vector<SSEDecoder::Event> events;
+  for (const auto& chunk : chunks) {
+    decoder.Feed(chunk, &events);
+  }
+  decoder.Finish(&events);
+  return events;
+}
+
+}  // namespace
+
+TEST(SSEDecoderTest, Fields) {
+  auto events = Decode(
+      {"\xEF\xBB\xBF: comment\n"
+       "event: completion\n"
+       "id: 1\n"
+       "data: first\n"
+       "data:second\n"
+       "unknown: field\n"
+       "\n"
+       "data\n"
+       "\n"
+       "id\n"
+       "data: third\n"
+       "\n"
+       "event: no data\n"
+       "\n"});
+  ASSERT_EQ(3u, events.size());
+  EXPECT_EQ("completion", events[0].type);
+  EXPECT_EQ("first\nsecond", events[0].data);
+  EXPECT_EQ("1", events[0].last_event_id);
+  // The type is reset after each event but the id isn't.
+  EXPECT_EQ("message", events[1].type);
+  EXPECT_EQ("", events[1].data);
+  EXPECT_EQ("1", events[1].last_event_id);
+  EXPECT_EQ("third", events[2].data);
+  EXPECT_EQ("", events[2].last_event_id);
+}
+
+TEST(SSEDecoderTest, LineBreaks) {
+  // CRLF, LF and CR all end a line, also when split between chunks.
+  auto events = Decode({"data: a\r", "\n", "\r\n", "data: b\n\ndata: c\r\r",
+                        "data: d\r", "\r"});
+  ASSERT_EQ(4u, events.size());
+  EXPECT_EQ("a", events[0].data);
+  EXPECT_EQ("b", events[1].data);
+  EXPECT_EQ("c", events[2].data);
+  EXPECT_EQ("d", events[3].data);
+}
+
+TEST(SSEDecoderTest, ChunkBoundaries) {
+  const std::string stream =
+      "event: completion\r\ndata: {\"completion\": \"Hello\"}\r\n\r\n"
+      ": ping\r\n"
+      "data: {\"completion\": \" there\"}\r\n\r\n";
+  // Every split point gives the same events.
+  for (size_t i = 0; i <= stream.size(); ++i) {
+    auto events = Decode({stream.substr(0, i), stream.substr(i)});
+    ASSERT_EQ(2u, events.size()) << i;
+    EXPECT_EQ("completion", events[0].type);
+    EXPECT_EQ("{\"completion\": \"Hello\"}", events[0].data);
+    EXPECT_EQ("message", events[1].type);
+    EXPECT_EQ("{\"completion\": \" there\"}", events[1].data);
+  }
+}
+
+TEST(SSEDecoderTest, UnterminatedEventIsDispatchedOnFinish) {
+  SSEDecoder decoder;
+  std::vector<SSEDecoder::Event> events;
+  decoder.Feed("data: {}\n\ndata: [DONE]", &events);
+  ASSERT_EQ(1u, events.size());
+  decoder.Finish(&events);
+  ASSERT_EQ(2u, events.size());
+  EXPECT_EQ("[DONE]", events[1].data);
+}
+
+TEST(SSEDecoderTest, Retry) {
+  SSEDecoder decoder;
+  std::vector<SSEDecoder::Event> events;
+  EXPECT_FALSE(decoder.retry());
+  decoder.Feed("retry: 1500\n", &events);
+  EXPECT_EQ(base::Milliseconds(1500), decoder.retry());
+  // Values that aren't all digits are ignored.
+  decoder.Feed("retry: 10s\nretry: -1\nretry:\n", &events);
+  EXPECT_EQ(base::Milliseconds(1500), decoder.retry());
+  EXPECT_TRUE(events.empty());
+}
+
+}  // namespace api_request_helper
@@ -168,6 +168,7 @@ bool BodySnifferURLLoader::CheckBufferedBody(uint32_t readBufferSize) {
     case MOJO_RESULT_OK:
       read_bytes_ += read_bytes;
       buffered_body_.resize(start_size + read_bytes);
+      tag_scanner_.Feed(base::StringPiece(buffered_body_).substr(start_size));
       return true;
     case MOJO_RESULT_FAILED_PRECONDITION:
       buffered_body_.resize(start_size);
@@ -12,6 +12,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
+#include "brave/components/body_sniffer/html_tag_scanner.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/receiver.h"
@@ -93,6 +94,8 @@ class BodySnifferURLLoader : public network::mojom::URLLoaderClient,
   void PauseReadingBodyFromNet() override;
   void ResumeReadingBodyFromNet() override;
 
+  // Reads the next chunk of the body into |buffered_body_| and feeds it to
+  // |tag_scanner_|.
   bool CheckBufferedBody(uint32_t readBufferSize);
 
   virtual void OnBodyReadable(MojoResult) = 0;
@@ -121,6 +124,13 @@ class BodySnifferURLLoader : public network::mojom::URLLoaderClient,
   absl::optional<network::URLLoaderCompletionStatus> complete_status_;
 
   std::string buffered_body_;
+  // Subclasses register the start tags they are interested in here, every
+  // chunk read by CheckBufferedBody() is scanned once for all of them. Only
+  // handlers registered on this loader share the pass: each throttle still
+  // inserts its own loader, and loaders that need the whole document, like
+  // Speedreader's, read |buffered_body_| directly. The scanner does no work
+  // when nothing is registered.
+  HtmlTagScanner tag_scanner_;
   size_t bytes_remaining_in_buffer_;
   size_t read_bytes_ = 0;
 
@@ -0,0 +1,123 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/body_sniffer/html_tag_scanner.h"
+
+#include <utility>
+
+#include "base/strings/string_util.h"
+
+namespace body_sniffer {
+
+namespace {
+
+// Tags longer than this are not dispatched, so a malformed body can't make us
+// buffer it whole.
+constexpr size_t kMaxTagLength = 16 * 1024;
+
+bool IsTagNameChar(char c) {
+  return base::IsAsciiAlphaNumeric(c) || c == '-' || c == ':';
+}
+
+}  // namespace
+
+HtmlTagScanner::HtmlTagScanner() = default;
+
+HtmlTagScanner::~HtmlTagScanner() = default;
+
+void HtmlTagScanner::AddTagHandler(const std::string& tag_name,
+                                   TagCallback callback) {
+  handlers_[base::ToLowerASCII(tag_name)].push_back(std::move(callback));
+}
+
+void HtmlTagScanner::Feed(base::StringPiece chunk) {
+  if (handlers_.empty()) {
+    return;
+  }
+
+  size_t pos = 0;
+  while (pos < chunk.size()) {
+    switch (state_) {
+      case State::kText: {
+        const size_t open = chunk.find('<', pos);
+        if (open == base::StringPiece::npos) {
+          return;
+        }
+        pending_tag_.assign(1, '<');
+        tag_name_.clear();
+        state_ = State::kTagOpen;
+        pos = open + 1;
+        break;
+      }
+      case State::kTagOpen: {
+        const char c = chunk[pos];
+        if (base::IsAsciiWhitespace(c)) {
+          pending_tag_.push_back(c);
+          ++pos;
+        } else if (base::IsAsciiAlpha(c)) {
+          state_ = State::kTagName;
+        } else {
+          // Not a start tag (comment, doctype, end tag, stray '<'). Let the
+          // text state look at this char again, it may open a new tag.
+          state_ = State::kText;
+        }
+        break;
+      }
+      case State::kTagName: {
+        const char c = chunk[pos];
+        if (IsTagNameChar(c)) {
+          tag_name_.push_back(base::ToLowerASCII(c));
+          pending_tag_.push_back(c);
+          ++pos;
+        } else if (c == '<') {
+          state_ = State::kText;
+        } else {
+          StartTagBody();
+        }
+        break;
+      }
+      case State::kTagBody:
+      case State::kSkipTag: {
+        const size_t close = chunk.find('>', pos);
+        const size_t end =
+            close == base::StringPiece::npos ? chunk.size() : close + 1;
+        if (state_ == State::kTagBody) {
+          if (pending_tag_.size() + end - pos > kMaxTagLength) {
+            pending_tag_.clear();
+            state_ = State::kSkipTag;
+          } else {
+            pending_tag_.append(chunk.data() + pos, end - pos);
+          }
+        }
+        pos = end;
+        if (close != base::StringPiece::npos) {
+          if (state_ == State::kTagBody) {
+            DispatchTag();
+          }
+          state_ = State::kText;
+        }
+        break;
+      }
+    }
+  }
+}
+
+void HtmlTagScanner::StartTagBody() {
+  if (handlers_.contains(tag_name_)) {
+    state_ = State::kTagBody;
+  } else {
+    pending_tag_.clear();
+    state_ = State::kSkipTag;
+  }
+}
+
+void HtmlTagScanner::DispatchTag() {
+  for (const auto& handler : handlers_[tag_name_]) {
+    handler.Run(pending_tag_);
+  }
+  pending_tag_.clear();
+}
+
+}  // namespace body_sniffer
@@ -0,0 +1,69 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BODY_SNIFFER_HTML_TAG_SCANNER_H_
+#define BRAVE_COMPONENTS_BODY_SNIFFER_HTML_TAG_SCANNER_H_
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
+#include "base/strings/string_piece.h"
+
+namespace body_sniffer {
+
+// Incrementally scans an HTML byte stream for start tags. The body may be fed
+// in arbitrary chunks: scanning resumes where the previous chunk stopped, so
+// the total cost is linear in the body size however it was split, and only
+// the bytes of a tag that is still being read are kept between chunks.
+//
+// Several sniffers can register handlers on the same scanner, so they share a
+// single pass over the body.
+class HtmlTagScanner {
+ public:
+  // Receives the raw text of a start tag, from '<' to the first '>'.
+  using TagCallback = base::RepeatingCallback<void(base::StringPiece tag)>;
+
+  HtmlTagScanner();
+  ~HtmlTagScanner();
+
+  HtmlTagScanner(const HtmlTagScanner&) = delete;
+  HtmlTagScanner& operator=(const HtmlTagScanner&) = delete;
+
+  // |tag_name| is matched case-insensitively. Must not be called from within a
+  // handler.
+  void AddTagHandler(const std::string& tag_name, TagCallback callback);
+
+  void Feed(base::StringPiece chunk);
+
+  // Returns true if the last chunk ended in the middle of a tag.
+  bool in_tag() const { return state_ != State::kText; }
+
+ private:
+  enum class State {
+    kText,
+    // Between '<' and the first letter of the tag name.
+    kTagOpen,
+    kTagName,
+    // Inside a tag someone listens to, accumulating it.
+    kTagBody,
+    // Inside a tag nobody listens to, waiting for the closing '>'.
+    kSkipTag,
+  };
+
+  void StartTagBody();
+  void DispatchTag();
+
+  base::flat_map<std::string, std::vector<TagCallback>> handlers_;
+
+  State state_ = State::kText;
+  std::string tag_name_;
+  std::string pending_tag_;
+};
+
+}  // namespace body_sniffer
+
+#endif  // BRAVE_COMPONENTS_BODY_SNIFFER_HTML_TAG_SCANNER_H_
@@ -0,0 +1,81 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/body_sniffer/html_tag_scanner.h"
+
+#include <string>
+#include <vector>
+
+#include "base/test/bind.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace body_sniffer {
+
+namespace {
+
+constexpr char kBody[] =
+    "<!DOCTYPE html>\n"
+    "<HTML amp lang=\"en\">\n"
+    "<head><title>a < b</title>\n"
+    "<link rel=\"author\" href=\"https://xyz.com\"/>\n"
+    "< link rel=canonical href=https://abc.com >\n"
+    "<meta charset=\"utf-8\"></head>\n"
+    "<body><p>text</p><linkage></body></html>";
+
+std::vector<std::string> Scan(const std::string& body, size_t chunk_size) {
+  std::vector<std::string> tags;
+  HtmlTagScanner scanner;
+  auto handler = base::BindLambdaForTesting(
+      [&](base::StringPiece tag) { tags.emplace_back(tag); });
+  scanner.AddTagHandler("html", handler);
+  scanner.AddTagHandler("LINK", handler);
+  for (size_t offset = 0; offset < body.size(); offset += chunk_size) {
+    scanner.Feed(base::StringPiece(body).substr(offset, chunk_size));
+  }
+  EXPECT_FALSE(scanner.in_tag());
+  return tags;
+}
+
+}  // namespace
+
+TEST(HtmlTagScannerUnitTest, FindsRegisteredTags) {
+  const std::vector<std::string> expected = {
+      "<HTML amp lang=\"en\">",
+      "<link rel=\"author\" href=\"https://xyz.com\"/>",
+      "< link rel=canonical href=https://abc.com >",
+  };
+  EXPECT_EQ(expected, Scan(kBody, sizeof(kBody)));
+}
+
+TEST(HtmlTagScannerUnitTest, ChunkBoundaries) {
+  const auto expected = Scan(kBody, sizeof(kBody));
+  for (size_t chunk_size = 1; chunk_size < 16; ++chunk_size) {
+    SCOPED_TRACE(chunk_size);
+    EXPECT_EQ(expected, Scan(kBody, chunk_size));
+  }
+}
+
+TEST(HtmlTagScannerUnitTest, InTag) {
+  HtmlTagScanner scanner;
+  int calls = 0;
+  scanner.AddTagHandler("html", base::BindLambdaForTesting(
+                                    [&](base::StringPiece tag) { ++calls; }));
+  scanner.Feed("<!DOCTYPE html><ht");
+  EXPECT_TRUE(scanner.in_tag());
+  scanner.Feed("ml amp");
+  EXPECT_TRUE(scanner.in_tag());
+  EXPECT_EQ(0, calls);
+  scanner.Feed("><head>");
+  EXPECT_FALSE(scanner.in_tag());
+  EXPECT_EQ(1, calls);
+}
+
+TEST(HtmlTagScannerUnitTest, NoHandlers) {
+  HtmlTagScanner scanner;
+  scanner.Feed("<html amp");
+  EXPECT_FALSE(scanner.in_tag());
+}
+
+}  // namespace body_sniffer
@@ -31,6 +31,8 @@ class AsyncDataStore {
   void AddTrainingInstance(
       std::vector<brave_federated::mojom::CovariateInfoPtr> training_instance,
       base::OnceCallback<void(bool)> callback);
+  void AddTrainingInstances(std::vector<TrainingInstance> training_instances,
+                            base::OnceCallback<void(bool)> callback);
   void LoadTrainingData(base::OnceCallback<void(TrainingData)> callback);
   void PurgeTrainingDataAfterExpirationDate();
 
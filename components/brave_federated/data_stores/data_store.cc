@@ -5,7 +5,10 @@
 
 #include "brave/components/brave_federated/data_stores/data_store.h"
 
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/containers/flat_map.h"
@@ -59,10 +62,54 @@ void BindCovariateToStatement(
   stmt->BindDouble(4, created_at.ToDoubleT());
 }
 
+brave_federated::mojom::CovariateInfoPtr CovariateFromStatement(
+    sql::Statement* stmt) {
+  DCHECK(stmt);
+
+  brave_federated::mojom::CovariateInfoPtr covariate =
+      brave_federated::mojom::CovariateInfo::New();
+  covariate->type = (brave_federated::mojom::CovariateType)stmt->ColumnInt(1);
+  covariate->data_type = (brave_federated::mojom::DataType)stmt->ColumnInt(2);
+  covariate->value = stmt->ColumnString(3);
+  return covariate;
+}
+
 }  // namespace
 
 namespace brave_federated {
 
+TrainingInstanceCursor::TrainingInstanceCursor(sql::Database* database,
+                                               const std::string& table_name)
+    : statement_(database->GetUniqueStatement(
+          base::StringPrintf("SELECT training_instance_id, feature_name, "
+                             "feature_type, feature_value FROM %s "
+                             "ORDER BY training_instance_id, id",
+                             table_name.c_str())
+              .c_str())) {
+  has_row_ = statement_.Step();
+}
+
+TrainingInstanceCursor::~TrainingInstanceCursor() = default;
+
+bool TrainingInstanceCursor::Next(int* training_instance_id,
+                                  TrainingInstance* training_instance) {
+  DCHECK(training_instance_id);
+  DCHECK(training_instance);
+
+  if (!has_row_) {
+    return false;
+  }
+
+  *training_instance_id = statement_.ColumnInt(0);
+  training_instance->clear();
+  do {
+    training_instance->push_back(CovariateFromStatement(&statement_));
+    has_row_ = statement_.Step();
+  } while (has_row_ && statement_.ColumnInt(0) == *training_instance_id);
+
+  return true;
+}
+
 DataStore::DataStore(const DataStoreTask data_store_task,
                      const base::FilePath& db_file_path)
     : database_(
@@ -85,22 +132,34 @@ bool DataStore::InitializeDatabase() {
 }
 
 int DataStore::GetNextTrainingInstanceId() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (next_training_instance_id_) {
+    return *next_training_instance_id_;
+  }
+
   sql::Statement statement(database_.GetUniqueStatement(
       base::StringPrintf("SELECT MAX(training_instance_id) FROM %s",
                          data_store_task_.name.c_str())
           .c_str()));
 
-  if (statement.Step()) {
-    return statement.ColumnInt(0) + 1;
+  if (!statement.Step()) {
+    return 0;
   }
-  return 0;
+  next_training_instance_id_ = statement.ColumnInt(0) + 1;
+  return *next_training_instance_id_;
 }
 
-void DataStore::SaveCovariate(
+bool DataStore::SaveCovariate(
     const brave_federated::mojom::CovariateInfo& covariate,
     int training_instance_id,
     const base::Time created_at) {
-  sql::Statement statement(database_.GetUniqueStatement(
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // Each DataStore has its own database with a single table, so the statement
+  // can be cached by call site.
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("INSERT INTO %s (training_instance_id, "
                          "feature_name, feature_type, "
                          "feature_value, created_at) "
@@ -110,7 +169,15 @@ void DataStore::SaveCovariate(
 
   BindCovariateToStatement(covariate, training_instance_id, created_at,
                            &statement);
-  statement.Run();
+  if (!statement.Run()) {
+    return false;
+  }
+
+  if (next_training_instance_id_ &&
+      training_instance_id >= *next_training_instance_id_) {
+    next_training_instance_id_ = training_instance_id + 1;
+  }
+  return true;
 }
 
 bool DataStore::AddTrainingInstance(
@@ -118,38 +185,83 @@ bool DataStore::AddTrainingInstance(
         training_instance) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
   const int training_instance_id = GetNextTrainingInstanceId();
+  if (!SaveTrainingInstance(training_instance, training_instance_id,
+                            base::Time::Now()) ||
+      !transaction.Commit()) {
+    next_training_instance_id_.reset();
+    return false;
+  }
+
+  return true;
+}
+
+bool DataStore::AddTrainingInstances(
+    const std::vector<TrainingInstance>& training_instances) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
   const base::Time created_at = base::Time::Now();
+  for (const auto& training_instance : training_instances) {
+    if (!SaveTrainingInstance(training_instance, GetNextTrainingInstanceId(),
+                              created_at)) {
+      // |transaction| rolls back the instances saved so far when it goes out
+      // of scope.
+      next_training_instance_id_.reset();
+      return false;
+    }
+  }
+  if (!transaction.Commit()) {
+    next_training_instance_id_.reset();
+    return false;
+  }
+
+  return true;
+}
 
+bool DataStore::SaveTrainingInstance(const TrainingInstance& training_instance,
+                                     int training_instance_id,
+                                     base::Time created_at) {
   for (const auto& covariate : training_instance) {
-    SaveCovariate(*covariate, training_instance_id, created_at);
+    if (!SaveCovariate(*covariate, training_instance_id, created_at)) {
+      return false;
+    }
   }
-
+  // Instances without covariates still use up an id.
+  next_training_instance_id_ = training_instance_id + 1;
   return true;
 }
 
 TrainingData DataStore::LoadTrainingData() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  TrainingData training_instances;
-  sql::Statement statement(database_.GetUniqueStatement(
-      base::StringPrintf("SELECT id, training_instance_id, feature_name, "
-                         "feature_type, feature_value FROM %s",
-                         data_store_task_.name.c_str())
-          .c_str()));
+  std::vector<std::pair<int, TrainingInstance>> training_instances;
+  std::unique_ptr<TrainingInstanceCursor> cursor = GetTrainingInstanceCursor();
+  int training_instance_id;
+  TrainingInstance training_instance;
+  while (cursor->Next(&training_instance_id, &training_instance)) {
+    training_instances.emplace_back(training_instance_id,
+                                    std::move(training_instance));
+  }
 
-  training_instances.clear();
-  while (statement.Step()) {
-    const int training_instance_id = statement.ColumnInt(1);
-    mojom::CovariateInfoPtr covariate = mojom::CovariateInfo::New();
-    covariate->type = (mojom::CovariateType)statement.ColumnInt(2);
-    covariate->data_type = (mojom::DataType)statement.ColumnInt(3);
-    covariate->value = statement.ColumnString(4);
+  // The cursor yields instances in id order, so the map doesn't need to sort.
+  return TrainingData(base::sorted_unique, std::move(training_instances));
+}
 
-    training_instances[training_instance_id].push_back(std::move(covariate));
-  }
+std::unique_ptr<TrainingInstanceCursor> DataStore::GetTrainingInstanceCursor() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  return training_instances;
+  return std::make_unique<TrainingInstanceCursor>(&database_,
+                                                  data_store_task_.name);
 }
 
 bool DataStore::DeleteTrainingData() {
@@ -160,6 +272,7 @@ bool DataStore::DeleteTrainingData() {
               .c_str()))
     return false;
 
+  next_training_instance_id_.reset();
   std::ignore = database_.Execute("VACUUM");
   return true;
 }
@@ -167,8 +280,9 @@ bool DataStore::DeleteTrainingData() {
 void DataStore::PurgeTrainingDataAfterExpirationDate() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement delete_statement(database_.GetUniqueStatement(
-      base::StringPrintf(" DELETE FROM %s WHERE created_at < ? OR id NOT IN "
+  sql::Statement delete_statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE created_at < ? OR id NOT IN "
                          "(SELECT id FROM %s ORDER BY id DESC LIMIT ?)",
                          data_store_task_.name.c_str(),
                          data_store_task_.name.c_str())
@@ -181,20 +295,30 @@ void DataStore::PurgeTrainingDataAfterExpirationDate() {
 }
 
 bool DataStore::MaybeCreateTable() {
-  if (database_.DoesTableExist(data_store_task_.name)) {
-    return true;
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
   }
 
-  sql::Transaction transaction(&database_);
-  return transaction.Begin() &&
-         database_.Execute(
-             base::StringPrintf(
-                 "CREATE TABLE %s (id INTEGER PRIMARY KEY AUTOINCREMENT, "
-                 "training_instance_id INTEGER NOT NULL, feature_name INTEGER "
-                 "NOT NULL, feature_type INTEGER NOT NULL, "
-                 "feature_value TEXT NOT NULL, created_at DOUBLE NOT NULL)",
-                 data_store_task_.name.c_str())
-                 .c_str()) &&
+  if (!database_.DoesTableExist(data_store_task_.name) &&
+      !database_.Execute(
+          base::StringPrintf(
+              "CREATE TABLE %s (id INTEGER PRIMARY KEY AUTOINCREMENT, "
+              "training_instance_id INTEGER NOT NULL, feature_name INTEGER "
+              "NOT NULL, feature_type INTEGER NOT NULL, "
+              "feature_value TEXT NOT NULL, created_at DOUBLE NOT NULL)",
+              data_store_task_.name.c_str())
+              .c_str())) {
+    return false;
+  }
+
+  // Tables created before the index was introduced get it here too.
+  return database_.Execute(base::StringPrintf(
+                               "CREATE INDEX IF NOT EXISTS %s_created_at_index "
+                               "ON %s (created_at)",
+                               data_store_task_.name.c_str(),
+                               data_store_task_.name.c_str())
+                               .c_str()) &&
          transaction.Commit();
 }
 
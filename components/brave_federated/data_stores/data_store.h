@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_DATA_STORES_DATA_STORE_H_
 #define BRAVE_COMPONENTS_BRAVE_FEDERATED_DATA_STORES_DATA_STORE_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,10 +15,13 @@
 #include "base/sequence_checker.h"
 #include "brave/components/brave_federated/public/interfaces/brave_federated.mojom.h"
 #include "sql/database.h"
+#include "sql/statement.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_federated {
 
-using TrainingData = base::flat_map<int, std::vector<mojom::CovariateInfoPtr>>;
+using TrainingInstance = std::vector<mojom::CovariateInfoPtr>;
+using TrainingData = base::flat_map<int, TrainingInstance>;
 
 struct DataStoreTask {
   int id = 0;
@@ -26,6 +30,27 @@ struct DataStoreTask {
   base::TimeDelta max_retention_days;
 };
 
+// Reads training instances one at a time, in training instance id order, so
+// that callers don't need to hold the whole data store in memory.
+class TrainingInstanceCursor {
+ public:
+  TrainingInstanceCursor(sql::Database* database,
+                         const std::string& table_name);
+  ~TrainingInstanceCursor();
+
+  TrainingInstanceCursor(const TrainingInstanceCursor&) = delete;
+  TrainingInstanceCursor& operator=(const TrainingInstanceCursor&) = delete;
+
+  // Reads the next training instance into |training_instance_id| and
+  // |training_instance|. Returns false once every instance has been read.
+  bool Next(int* training_instance_id, TrainingInstance* training_instance);
+
+ private:
+  sql::Statement statement_;
+  // Whether |statement_| is positioned on a row that hasn't been read yet.
+  bool has_row_ = false;
+};
+
 class DataStore {
  public:
   explicit DataStore(const DataStoreTask data_store_task,
@@ -38,15 +63,20 @@ class DataStore {
   bool InitializeDatabase();
 
   int GetNextTrainingInstanceId();
-  void SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
+  bool SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
                      int training_instance_id,
                      const base::Time created_at);
   bool AddTrainingInstance(
       const std::vector<brave_federated::mojom::CovariateInfoPtr>
           training_instance);
+  // Adds all of |training_instances| in a single transaction. Either all of
+  // them are saved or none are.
+  bool AddTrainingInstances(
+      const std::vector<TrainingInstance>& training_instances);
 
   bool DeleteTrainingData();
   TrainingData LoadTrainingData();
+  std::unique_ptr<TrainingInstanceCursor> GetTrainingInstanceCursor();
   void PurgeTrainingDataAfterExpirationDate();
 
  protected:
@@ -58,6 +88,13 @@ class DataStore {
 
  private:
   bool MaybeCreateTable();
+  bool SaveTrainingInstance(const TrainingInstance& training_instance,
+                            int training_instance_id,
+                            base::Time created_at);
+
+  // Loaded from the database on first use and kept up to date as instances
+  // are added, so that adding an instance doesn't need to query for it.
+  absl::optional<int> next_training_instance_id_;
 
   SEQUENCE_CHECKER(sequence_checker_);
 };
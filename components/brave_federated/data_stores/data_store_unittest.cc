@@ -6,10 +6,13 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/path_service.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
 #include "base/time/time.h"
 #include "brave/components/brave_federated/data_stores/data_store.h"
 #include "content/public/test/browser_task_environment.h"
@@ -17,6 +20,7 @@
 #include "sql/test/scoped_error_expecter.h"
 #include "sql/test/test_helpers.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/sqlite/sqlite3.h"
 
 // npm run test -- brave_unit_tests --filter=DataStoreTest*
 
@@ -46,6 +50,9 @@ class DataStoreTest : public testing::Test {
 
   int RecordCount() const;
   int TrainingInstanceCount() const;
+  bool HasCreatedAtIndex();
+  // Makes inserting a covariate with |feature_value| fail.
+  void FailInsertsWithValue(const std::string& feature_value);
 
   TrainingData TrainingDataFromTestInfo();
 
@@ -85,6 +92,21 @@ int DataStoreTest::TrainingInstanceCount() const {
   return statement.ColumnInt(0);
 }
 
+bool DataStoreTest::HasCreatedAtIndex() {
+  return data_store_->database_.DoesIndexExist(
+      "test_federated_task_created_at_index");
+}
+
+void DataStoreTest::FailInsertsWithValue(const std::string& feature_value) {
+  // Triggers can't use bound parameters.
+  ASSERT_TRUE(data_store_->database_.Execute(
+      base::StringPrintf("CREATE TRIGGER fail_insert BEFORE INSERT ON "
+                         "test_federated_task WHEN NEW.feature_value = '%s' "
+                         "BEGIN SELECT RAISE(ABORT, 'fail'); END",
+                         feature_value.c_str())
+          .c_str()));
+}
+
 TrainingData DataStoreTest::TrainingDataFromTestInfo() {
   TrainingData training_data;
 
@@ -192,4 +214,114 @@ TEST_F(DataStoreTest, PurgeTrainingDataAfterExpirationDate) {
   EXPECT_EQ(0, RecordCount());
 }
 
+TEST_F(DataStoreTest, AddTrainingInstances) {
+  TrainingData training_data = TrainingDataFromTestInfo();
+  std::vector<TrainingInstance> training_instances;
+  training_instances.push_back(std::move(training_data[0]));
+  training_instances.push_back(std::move(training_data[1]));
+
+  EXPECT_TRUE(data_store_->AddTrainingInstances(training_instances));
+  EXPECT_EQ(4, RecordCount());
+  EXPECT_EQ(2, TrainingInstanceCount());
+  EXPECT_EQ(3, data_store_->GetNextTrainingInstanceId());
+}
+
+TEST_F(DataStoreTest, NextTrainingInstanceIdSurvivesReopen) {
+  InitializeDataStore();
+  EXPECT_EQ(3, data_store_->GetNextTrainingInstanceId());
+
+  data_store_ = std::make_unique<DataStore>(
+      DataStoreTask({0, "test_federated_task",
+                     /* max_number_of_records */ 50, base::Days(30)}),
+      temp_dir_.GetPath().Append(FILE_PATH_LITERAL("test_data_store")));
+  ASSERT_TRUE(data_store_->InitializeDatabase());
+  EXPECT_EQ(3, data_store_->GetNextTrainingInstanceId());
+
+  EXPECT_TRUE(data_store_->DeleteTrainingData());
+  EXPECT_EQ(1, data_store_->GetNextTrainingInstanceId());
+}
+
+TEST_F(DataStoreTest, CreatedAtIndex) {
+  EXPECT_TRUE(HasCreatedAtIndex());
+}
+
+TEST_F(DataStoreTest, AddTrainingInstancesFailure) {
+  InitializeDataStore();
+  FailInsertsWithValue("dog");
+
+  TrainingData training_data = TrainingDataFromTestInfo();
+  std::vector<TrainingInstance> training_instances;
+  training_instances.push_back(std::move(training_data[0]));
+  training_instances.push_back(std::move(training_data[1]));
+
+  {
+    sql::test::ScopedErrorExpecter expecter;
+    expecter.ExpectError(SQLITE_CONSTRAINT);
+    EXPECT_FALSE(data_store_->AddTrainingInstances(training_instances));
+    EXPECT_TRUE(expecter.SawExpectedErrors());
+  }
+
+  // The first instance was saved before the failing one, but is rolled back
+  // with it.
+  EXPECT_EQ(4, RecordCount());
+  EXPECT_EQ(2, TrainingInstanceCount());
+  EXPECT_EQ(3, data_store_->GetNextTrainingInstanceId());
+}
+
+TEST_F(DataStoreTest, TrainingInstanceCursor) {
+  InitializeDataStore();
+  // Interleave the covariates of two instances.
+  TrainingData training_data = TrainingDataFromTestInfo();
+  data_store_->SaveCovariate(*training_data[0][0], 5, base::Time::Now());
+  data_store_->SaveCovariate(*training_data[1][0], 4, base::Time::Now());
+  data_store_->SaveCovariate(*training_data[0][1], 5, base::Time::Now());
+
+  std::unique_ptr<TrainingInstanceCursor> cursor =
+      data_store_->GetTrainingInstanceCursor();
+  int training_instance_id = 0;
+  TrainingInstance training_instance;
+  std::vector<int> training_instance_ids;
+  std::vector<size_t> training_instance_sizes;
+  while (cursor->Next(&training_instance_id, &training_instance)) {
+    training_instance_ids.push_back(training_instance_id);
+    training_instance_sizes.push_back(training_instance.size());
+  }
+  EXPECT_EQ(std::vector<int>({1, 2, 4, 5}), training_instance_ids);
+  EXPECT_EQ(std::vector<size_t>({2, 2, 1, 2}), training_instance_sizes);
+  EXPECT_EQ("cat", training_instance[0]->value);
+  EXPECT_EQ(6, data_store_->GetNextTrainingInstanceId());
+}
+
+TEST_F(DataStoreTest, AddManyCovariates) {
+  constexpr int kTrainingInstanceCount = 10000;
+  constexpr int kCovariatesPerInstance = 10;
+
+  std::vector<TrainingInstance> training_instances(kTrainingInstanceCount);
+  for (auto& training_instance : training_instances) {
+    for (int i = 0; i < kCovariatesPerInstance; ++i) {
+      mojom::CovariateInfoPtr covariate = mojom::CovariateInfo::New();
+      covariate->type = mojom::CovariateType::kNumberOfOpenedNewTabEvents;
+      covariate->data_type = mojom::DataType::kInt;
+      covariate->value = base::NumberToString(i);
+      training_instance.push_back(std::move(covariate));
+    }
+  }
+
+  EXPECT_TRUE(data_store_->AddTrainingInstances(training_instances));
+  EXPECT_EQ(kTrainingInstanceCount * kCovariatesPerInstance, RecordCount());
+
+  std::unique_ptr<TrainingInstanceCursor> cursor =
+      data_store_->GetTrainingInstanceCursor();
+  int training_instance_id = 0;
+  TrainingInstance training_instance;
+  int count = 0;
+  while (cursor->Next(&training_instance_id, &training_instance)) {
+    ++count;
+    EXPECT_EQ(count, training_instance_id);
+    ASSERT_EQ(static_cast<size_t>(kCovariatesPerInstance),
+              training_instance.size());
+  }
+  EXPECT_EQ(kTrainingInstanceCount, count);
+}
+
 }  // namespace brave_federated
@@ -5,8 +5,9 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry.h"
 
-#include <tuple>
+#include <utility>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
@@ -27,9 +28,8 @@ namespace brave_perf_predictor {
 
 namespace {
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
+ThirdPartyDomainTrie ParseMappings(const base::StringPiece entities,
+                                   bool discard_irrelevant) {
   base::flat_map<std::string, std::string> entity_by_domain;
   base::flat_map<std::string, std::string> entity_by_root_domain;
 
@@ -81,14 +81,10 @@ ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
     }
   }
 
-  entity_by_domain.shrink_to_fit();
-  entity_by_root_domain.shrink_to_fit();
-  return std::make_tuple(entity_by_domain, entity_by_root_domain);
+  return ThirdPartyDomainTrie(entity_by_domain, entity_by_root_domain);
 }
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseFromResource(int resource_id) {
+ThirdPartyDomainTrie ParseFromResource(int resource_id) {
   // TODO(AndriusA): insert trace event here
   SCOPED_UMA_HISTOGRAM_TIMER(
       "Brave.Savings.NamedThirdPartyRegistry.LoadTimeMS");
@@ -104,13 +100,10 @@ ParseFromResource(int resource_id) {
 bool NamedThirdPartyRegistry::LoadMappings(const base::StringPiece entities,
                                            bool discard_irrelevant) {
   // Reset previous mappings
-  entity_by_domain_.clear();
-  entity_by_root_domain_.clear();
   initialized_ = false;
 
-  tie(entity_by_domain_, entity_by_root_domain_) =
-      ParseMappings(entities, discard_irrelevant);
-  if (entity_by_domain_.size() == 0 || entity_by_root_domain_.size() == 0)
+  entity_mappings_ = ParseMappings(entities, discard_irrelevant);
+  if (entity_mappings_.empty())
     return false;
 
   initialized_ = true;
@@ -118,11 +111,11 @@ bool NamedThirdPartyRegistry::LoadMappings(const base::StringPiece entities,
 }
 
 void NamedThirdPartyRegistry::UpdateMappings(
-    std::tuple<base::flat_map<std::string, std::string>,
-               base::flat_map<std::string, std::string>> entity_mappings) {
-  tie(entity_by_domain_, entity_by_root_domain_) = entity_mappings;
-  VLOG(2) << "Loaded " << entity_by_domain_.size() << " mappings by domain and "
-          << entity_by_root_domain_.size() << " by root domain; size";
+    ThirdPartyDomainTrie entity_mappings) {
+  entity_mappings_ = std::move(entity_mappings);
+  VLOG(2) << "Loaded " << entity_mappings_.domain_count()
+          << " mappings by domain and " << entity_mappings_.root_domain_count()
+          << " by root domain; size";
   initialized_ = true;
 }
 
@@ -138,16 +131,9 @@ absl::optional<std::string> NamedThirdPartyRegistry::GetThirdParty(
     return absl::nullopt;
 
   if (url.has_host()) {
-    auto domain_entry = entity_by_domain_.find(url.host());
-    if (domain_entry != entity_by_domain_.end())
-      return domain_entry->second;
-
-    auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
-        url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-
-    auto root_domain_entry = entity_by_root_domain_.find(root_domain);
-    if (root_domain_entry != entity_by_root_domain_.end())
-      return root_domain_entry->second;
+    const std::string* entity = entity_mappings_.Find(url.host_piece());
+    if (entity)
+      return *entity;
   }
 
   return absl::nullopt;
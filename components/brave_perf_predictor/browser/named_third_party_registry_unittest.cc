@@ -119,4 +119,41 @@ TEST(NamedThirdPartyRegistryTest, HandlesUnrecognisedThirdPartyTest) {
   EXPECT_FALSE(entity.has_value());
 }
 
+TEST(NamedThirdPartyRegistryTest, MatchesDomainsAndRootDomains) {
+  NamedThirdPartyRegistry extractor;
+  ASSERT_TRUE(extractor.LoadMappings(test_mapping, false));
+
+  EXPECT_EQ("Facebook",
+            extractor.GetThirdParty("https://static.xx.fbcdn.net/app.js"));
+  EXPECT_EQ("Facebook", extractor.GetThirdParty("https://fbcdn.net"));
+  EXPECT_EQ("Facebook", extractor.GetThirdParty("https://a.b.fbcdn.net"));
+  EXPECT_EQ("Google Analytics",
+            extractor.GetThirdParty("https://x.ssl.google-analytics.com"));
+  EXPECT_FALSE(extractor.GetThirdParty("https://fbcdn.net.example.com"));
+  EXPECT_FALSE(extractor.GetThirdParty("https://net"));
+  EXPECT_FALSE(extractor.GetThirdParty("not a url"));
+
+  // IP addresses only match exactly, and hosts without a root domain don't
+  // match any entity.
+  EXPECT_EQ("Facebook", extractor.GetThirdParty("http://23.62.3.183/"));
+  EXPECT_FALSE(extractor.GetThirdParty("http://24.62.3.183/"));
+  EXPECT_FALSE(extractor.GetThirdParty("http://localhost/"));
+}
+
+TEST(NamedThirdPartyRegistryTest, IgnoresSharedRootDomains) {
+  NamedThirdPartyRegistry extractor;
+  ASSERT_TRUE(extractor.LoadMappings(R"([
+    {"name": "A", "domains": ["a.example.com", "a.example.net"]},
+    {"name": "B", "domains": ["b.example.com"]}
+  ])",
+                                     false));
+
+  EXPECT_EQ("A", extractor.GetThirdParty("https://a.example.com"));
+  EXPECT_EQ("B", extractor.GetThirdParty("https://b.example.com"));
+  EXPECT_EQ("A", extractor.GetThirdParty("https://c.example.net"));
+  // example.com is used by both entities, so its other hosts have neither.
+  EXPECT_FALSE(extractor.GetThirdParty("https://c.example.com"));
+  EXPECT_FALSE(extractor.GetThirdParty("https://x.a.example.com"));
+}
+
 }  // namespace brave_perf_predictor
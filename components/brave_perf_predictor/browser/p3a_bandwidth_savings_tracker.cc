@@ -45,18 +45,25 @@ P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(PrefService* user_prefs)
 P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(
     PrefService* user_prefs,
     std::unique_ptr<base::Clock> clock)
-    : user_prefs_(user_prefs), clock_(std::move(clock)) {}
+    : user_prefs_(user_prefs), clock_(std::move(clock)) {
+  if (user_prefs_) {
+    weekly_savings_ = std::make_unique<WeeklyStorage>(
+        user_prefs_, prefs::kBandwidthSavedDailyBytes);
+  }
+}
 
 void P3ABandwidthSavingsTracker::RecordSavings(uint64_t savings) {
-  if (savings > 0 && user_prefs_) {
-    // TODO(AndriusA): optimise if needed, loading permanent state on every
-    // record could be costly
-    WeeklyStorage weekly(user_prefs_, prefs::kBandwidthSavedDailyBytes);
-    weekly.AddDelta(savings);
-    StoreSavingsHistogram(weekly.GetWeeklySum());
+  if (savings > 0 && weekly_savings_) {
+    weekly_savings_->AddDelta(savings);
+    StoreSavingsHistogram(weekly_savings_->GetWeeklySum());
   }
 }
 
+void P3ABandwidthSavingsTracker::Shutdown() {
+  // Writes pending savings while the prefs are still around.
+  weekly_savings_.reset();
+}
+
 P3ABandwidthSavingsTracker::~P3ABandwidthSavingsTracker() = default;
 
 // static
@@ -0,0 +1,43 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/p3a_bandwidth_savings_tracker_factory.h"
+
+#include "base/no_destructor.h"
+#include "brave/components/brave_perf_predictor/browser/p3a_bandwidth_savings_tracker.h"
+#include "components/keyed_service/content/browser_context_dependency_manager.h"
+#include "components/user_prefs/user_prefs.h"
+
+namespace brave_perf_predictor {
+
+// static
+P3ABandwidthSavingsTrackerFactory*
+P3ABandwidthSavingsTrackerFactory::GetInstance() {
+  static base::NoDestructor<P3ABandwidthSavingsTrackerFactory> instance;
+  return instance.get();
+}
+
+// static
+P3ABandwidthSavingsTracker*
+P3ABandwidthSavingsTrackerFactory::GetForBrowserContext(
+    content::BrowserContext* context) {
+  return static_cast<P3ABandwidthSavingsTracker*>(
+      GetInstance()->GetServiceForBrowserContext(context, true /*create*/));
+}
+
+P3ABandwidthSavingsTrackerFactory::P3ABandwidthSavingsTrackerFactory()
+    : BrowserContextKeyedServiceFactory(
+          "P3ABandwidthSavingsTracker",
+          BrowserContextDependencyManager::GetInstance()) {}
+
+P3ABandwidthSavingsTrackerFactory::~P3ABandwidthSavingsTrackerFactory() =
+    default;
+
+KeyedService* P3ABandwidthSavingsTrackerFactory::BuildServiceInstanceFor(
+    content::BrowserContext* context) const {
+  return new P3ABandwidthSavingsTracker(user_prefs::UserPrefs::Get(context));
+}
+
+}  // namespace brave_perf_predictor
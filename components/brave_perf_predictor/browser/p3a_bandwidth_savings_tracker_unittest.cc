@@ -8,10 +8,14 @@
 #include <memory>
 #include <utility>
 
+#include "base/functional/bind.h"
 #include "base/memory/raw_ptr.h"
 #include "base/test/metrics/histogram_tester.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
+#include "brave/components/brave_perf_predictor/common/pref_names.h"
+#include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -30,6 +34,8 @@ class P3ABandwidthSavingsTrackerTest : public ::testing::Test {
   }
 
  protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   raw_ptr<base::SimpleTestClock> clock_ = nullptr;
   TestingPrefServiceSimple pref_service_;
   std::unique_ptr<P3ABandwidthSavingsTracker> tracker_;
@@ -57,4 +63,28 @@ TEST_F(P3ABandwidthSavingsTrackerTest, RecordSavingsHistogramLargeIncrements) {
   tester.ExpectBucketCount(kSavingsDailyUMAHistogramName, 6, 1);
 }
 
+TEST_F(P3ABandwidthSavingsTrackerTest, RecordSavingsWritesPrefsOnce) {
+  int pref_writes = 0;
+  PrefChangeRegistrar registrar;
+  registrar.Init(&pref_service_);
+  registrar.Add(prefs::kBandwidthSavedDailyBytes,
+                base::BindRepeating([](int* writes) { ++*writes; },
+                                    &pref_writes));
+
+  base::HistogramTester tester;
+  for (int i = 0; i < 10; ++i) {
+    tracker_->RecordSavings(10 << 20);
+  }
+  tester.ExpectTotalCount(kSavingsDailyUMAHistogramName, 10);
+  tester.ExpectBucketCount(kSavingsDailyUMAHistogramName, 2, 5);
+  EXPECT_EQ(0, pref_writes);
+
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(1, pref_writes);
+
+  tracker_->RecordSavings(10 << 20);
+  tracker_->Shutdown();
+  EXPECT_EQ(2, pref_writes);
+}
+
 }  // namespace brave_perf_predictor
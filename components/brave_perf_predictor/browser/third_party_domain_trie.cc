@@ -0,0 +1,178 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/third_party_domain_trie.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/containers/queue.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/strings/string_split.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+
+namespace brave_perf_predictor {
+
+namespace {
+
+// The trie as it is being built, before it is flattened.
+struct BuilderNode {
+  std::map<std::string, std::unique_ptr<BuilderNode>> children;
+  int32_t entity = -1;
+  int32_t root_entity = -1;
+};
+
+BuilderNode* AddDomain(BuilderNode* root, base::StringPiece domain) {
+  BuilderNode* node = root;
+  const std::vector<base::StringPiece> labels = base::SplitStringPiece(
+      domain, ".", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
+  for (auto label = labels.rbegin(); label != labels.rend(); ++label) {
+    auto& child = node->children[std::string(*label)];
+    if (!child)
+      child = std::make_unique<BuilderNode>();
+    node = child.get();
+  }
+  return node;
+}
+
+// Returns the length of the root domain (eTLD+1) at the end of |host|, or 0
+// if it doesn't have one.
+size_t GetRootDomainLength(base::StringPiece host) {
+  const size_t registry_length =
+      net::registry_controlled_domains::GetCanonicalHostRegistryLength(
+          host, net::registry_controlled_domains::EXCLUDE_UNKNOWN_REGISTRIES,
+          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  if (registry_length == 0 || registry_length == std::string::npos ||
+      registry_length + 1 >= host.size()) {
+    return 0;
+  }
+  const size_t dot = host.rfind('.', host.size() - registry_length - 2);
+  return host.size() - (dot == base::StringPiece::npos ? 0 : dot + 1);
+}
+
+}  // namespace
+
+ThirdPartyDomainTrie::ThirdPartyDomainTrie() = default;
+
+ThirdPartyDomainTrie::ThirdPartyDomainTrie(
+    const base::flat_map<std::string, std::string>& entity_by_domain,
+    const base::flat_map<std::string, std::string>& entity_by_root_domain) {
+  base::flat_map<base::StringPiece, int32_t> entity_ids;
+  auto get_entity_id = [&](const std::string& entity) {
+    auto inserted = entity_ids.emplace(
+        entity, base::checked_cast<int32_t>(entities_.size()));
+    if (inserted.second)
+      entities_.push_back(entity);
+    return inserted.first->second;
+  };
+
+  BuilderNode root;
+  for (const auto& [domain, entity] : entity_by_domain) {
+    AddDomain(&root, domain)->entity = get_entity_id(entity);
+  }
+  for (const auto& [root_domain, entity] : entity_by_root_domain) {
+    // Hosts without a root domain, such as IP addresses, aren't matched by
+    // it.
+    if (root_domain.empty())
+      continue;
+    AddDomain(&root, root_domain)->root_entity = get_entity_id(entity);
+    root_domain_count_++;
+  }
+  domain_count_ = entity_by_domain.size();
+
+  // Flatten the trie breadth first, so that the children of each node are
+  // next to each other in |nodes_|, in the order of their labels.
+  nodes_.emplace_back();
+  base::queue<std::pair<const BuilderNode*, size_t>> pending;
+  pending.emplace(&root, 0);
+  while (!pending.empty()) {
+    const auto [builder_node, index] = pending.front();
+    pending.pop();
+    nodes_[index].first_child = base::checked_cast<uint32_t>(nodes_.size());
+    nodes_[index].child_count =
+        base::checked_cast<uint32_t>(builder_node->children.size());
+    for (const auto& [label, child] : builder_node->children) {
+      Node node;
+      node.label_offset = base::checked_cast<uint32_t>(labels_.size());
+      node.label_length = base::checked_cast<uint32_t>(label.size());
+      node.entity = child->entity;
+      node.root_entity = child->root_entity;
+      labels_.append(label);
+      pending.emplace(child.get(), nodes_.size());
+      nodes_.push_back(node);
+    }
+  }
+  nodes_.shrink_to_fit();
+  labels_.shrink_to_fit();
+}
+
+ThirdPartyDomainTrie::ThirdPartyDomainTrie(ThirdPartyDomainTrie&&) = default;
+ThirdPartyDomainTrie& ThirdPartyDomainTrie::operator=(ThirdPartyDomainTrie&&) =
+    default;
+ThirdPartyDomainTrie::~ThirdPartyDomainTrie() = default;
+
+const std::string* ThirdPartyDomainTrie::Find(base::StringPiece host) const {
+  if (nodes_.empty())
+    return nullptr;
+
+  // Walk the labels of |host| from the last one. Remember the node of its
+  // root domain on the way, in case |host| itself isn't known. The root
+  // domain is only computed if a root domain node is reached.
+  const Node* node = &nodes_[0];
+  const Node* root_domain_node = nullptr;
+  size_t root_domain_length = base::StringPiece::npos;
+  size_t label_end = host.size();
+  while (true) {
+    const size_t dot = label_end == 0 ? base::StringPiece::npos
+                                      : host.rfind('.', label_end - 1);
+    const size_t label_start = dot == base::StringPiece::npos ? 0 : dot + 1;
+    node = FindChild(*node, host.substr(label_start, label_end - label_start));
+    if (!node)
+      break;
+    if (node->root_entity >= 0) {
+      if (root_domain_length == base::StringPiece::npos)
+        root_domain_length = GetRootDomainLength(host);
+      if (host.size() - label_start == root_domain_length)
+        root_domain_node = node;
+    }
+    if (dot == base::StringPiece::npos) {
+      if (node->entity >= 0)
+        return &entities_[node->entity];
+      break;
+    }
+    label_end = dot;
+  }
+
+  if (root_domain_node)
+    return &entities_[root_domain_node->root_entity];
+  return nullptr;
+}
+
+base::StringPiece ThirdPartyDomainTrie::GetLabel(const Node& node) const {
+  return base::StringPiece(labels_).substr(node.label_offset,
+                                           node.label_length);
+}
+
+const ThirdPartyDomainTrie::Node* ThirdPartyDomainTrie::FindChild(
+    const Node& node,
+    base::StringPiece label) const {
+  DCHECK_LE(node.first_child + node.child_count, nodes_.size());
+  const Node* first = nodes_.data() + node.first_child;
+  const Node* last = first + node.child_count;
+  const Node* child = std::lower_bound(
+      first, last, label,
+      [this](const Node& candidate, base::StringPiece key) {
+        return GetLabel(candidate) < key;
+      });
+  if (child == last || GetLabel(*child) != label)
+    return nullptr;
+  return child;
+}
+
+}  // namespace brave_perf_predictor
@@ -0,0 +1,71 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_THIRD_PARTY_DOMAIN_TRIE_H_
+#define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_THIRD_PARTY_DOMAIN_TRIE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
+
+namespace brave_perf_predictor {
+
+// Maps hosts to the third party entity that owns them. Domains are stored as
+// a trie of their labels in reverse order ("net", "facebook", "connect"),
+// flattened into a single array of nodes with the children of each node
+// sorted by label, so a lookup walks the labels of a host once and doesn't
+// allocate.
+class ThirdPartyDomainTrie {
+ public:
+  ThirdPartyDomainTrie();
+  // |entity_by_root_domain| holds the entity of each root domain (eTLD+1)
+  // that is only used by one entity.
+  ThirdPartyDomainTrie(
+      const base::flat_map<std::string, std::string>& entity_by_domain,
+      const base::flat_map<std::string, std::string>& entity_by_root_domain);
+  ThirdPartyDomainTrie(ThirdPartyDomainTrie&&);
+  ThirdPartyDomainTrie& operator=(ThirdPartyDomainTrie&&);
+  ~ThirdPartyDomainTrie();
+
+  ThirdPartyDomainTrie(const ThirdPartyDomainTrie&) = delete;
+  ThirdPartyDomainTrie& operator=(const ThirdPartyDomainTrie&) = delete;
+
+  // Returns the entity of the canonical |host| if it is a known domain,
+  // otherwise the entity of its root domain, or null if neither is known.
+  const std::string* Find(base::StringPiece host) const;
+
+  bool empty() const { return domain_count_ == 0; }
+  size_t domain_count() const { return domain_count_; }
+  size_t root_domain_count() const { return root_domain_count_; }
+
+ private:
+  struct Node {
+    uint32_t label_offset = 0;
+    uint32_t label_length = 0;
+    uint32_t first_child = 0;
+    uint32_t child_count = 0;
+    // Indices into |entities_|, or -1.
+    int32_t entity = -1;
+    int32_t root_entity = -1;
+  };
+
+  base::StringPiece GetLabel(const Node& node) const;
+  const Node* FindChild(const Node& node, base::StringPiece label) const;
+
+  // |nodes_[0]| is the root of the trie.
+  std::vector<Node> nodes_;
+  // The labels of all nodes, back to back.
+  std::string labels_;
+  std::vector<std::string> entities_;
+  size_t domain_count_ = 0;
+  size_t root_domain_count_ = 0;
+};
+
+}  // namespace brave_perf_predictor
+
+#endif  // BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_THIRD_PARTY_DOMAIN_TRIE_H_
@@ -0,0 +1,102 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/third_party_domain_trie.h"
+
+#include <string>
+
+#include "base/strings/string_piece.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_perf_predictor {
+
+namespace {
+
+std::string FindEntity(const ThirdPartyDomainTrie& trie,
+                       base::StringPiece host) {
+  const std::string* entity = trie.Find(host);
+  return entity ? *entity : "<none>";
+}
+
+ThirdPartyDomainTrie MakeTrie() {
+  return ThirdPartyDomainTrie(
+      {
+          {"www.facebook.com", "Facebook"},
+          {"connect.facebook.net", "Facebook"},
+          {"google-analytics.com", "Google Analytics"},
+          {"23.62.3.183", "Akamai"},
+          {"[2001:db8::1]", "IPv6"},
+      },
+      {
+          {"facebook.com", "Facebook"},
+          {"google-analytics.com", "Google Analytics"},
+          {"foo.github.io", "Foo"},
+          // IP addresses have no root domain and are skipped.
+          {"", "Nobody"},
+      });
+}
+
+}  // namespace
+
+TEST(ThirdPartyDomainTrieTest, Empty) {
+  const ThirdPartyDomainTrie trie;
+  EXPECT_TRUE(trie.empty());
+  EXPECT_EQ(nullptr, trie.Find("www.facebook.com"));
+  EXPECT_EQ(nullptr, trie.Find(""));
+}
+
+TEST(ThirdPartyDomainTrieTest, Counts) {
+  const ThirdPartyDomainTrie trie = MakeTrie();
+  EXPECT_FALSE(trie.empty());
+  EXPECT_EQ(5u, trie.domain_count());
+  EXPECT_EQ(3u, trie.root_domain_count());
+}
+
+TEST(ThirdPartyDomainTrieTest, FindsDomains) {
+  const ThirdPartyDomainTrie trie = MakeTrie();
+  EXPECT_EQ("Facebook", FindEntity(trie, "www.facebook.com"));
+  EXPECT_EQ("Facebook", FindEntity(trie, "connect.facebook.net"));
+  EXPECT_EQ("Google Analytics", FindEntity(trie, "google-analytics.com"));
+
+  // Other hosts fall back to their root domain.
+  EXPECT_EQ("Facebook", FindEntity(trie, "facebook.com"));
+  EXPECT_EQ("Facebook", FindEntity(trie, "a.b.facebook.com"));
+  EXPECT_EQ("Google Analytics",
+            FindEntity(trie, "ssl.google-analytics.com"));
+  EXPECT_EQ("Foo", FindEntity(trie, "a.foo.github.io"));
+
+  // facebook.net isn't a root domain of any entity.
+  EXPECT_EQ("<none>", FindEntity(trie, "other.facebook.net"));
+  EXPECT_EQ("<none>", FindEntity(trie, "facebook.net"));
+  // A known domain doesn't match the hosts it is a suffix of.
+  EXPECT_EQ("<none>", FindEntity(trie, "facebook.com.example.org"));
+  EXPECT_EQ("<none>", FindEntity(trie, "notfacebook.com"));
+  EXPECT_EQ("<none>", FindEntity(trie, "com"));
+  EXPECT_EQ("<none>", FindEntity(trie, "github.io"));
+  EXPECT_EQ("<none>", FindEntity(trie, "bar.github.io"));
+}
+
+TEST(ThirdPartyDomainTrieTest, EmptyLabels) {
+  const ThirdPartyDomainTrie trie = MakeTrie();
+  // The trailing dot is an empty last label, which no domain has.
+  EXPECT_EQ("<none>", FindEntity(trie, "www.facebook.com."));
+  EXPECT_EQ("<none>", FindEntity(trie, "facebook.com."));
+  EXPECT_EQ("<none>", FindEntity(trie, "."));
+  EXPECT_EQ("<none>", FindEntity(trie, ""));
+}
+
+TEST(ThirdPartyDomainTrieTest, IPAddresses) {
+  const ThirdPartyDomainTrie trie = MakeTrie();
+  EXPECT_EQ("Akamai", FindEntity(trie, "23.62.3.183"));
+  EXPECT_EQ("<none>", FindEntity(trie, "1.23.62.3.183"));
+  EXPECT_EQ("<none>", FindEntity(trie, "62.3.183"));
+
+  // IPv6 hosts are a single label, brackets included.
+  EXPECT_EQ("IPv6", FindEntity(trie, "[2001:db8::1]"));
+  EXPECT_EQ("<none>", FindEntity(trie, "[2001:db8::2]"));
+  EXPECT_EQ("<none>", FindEntity(trie, "2001:db8::1"));
+}
+
+}  // namespace brave_perf_predictor
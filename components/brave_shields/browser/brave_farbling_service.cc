@@ -6,6 +6,8 @@
 #include "brave/components/brave_shields/browser/brave_farbling_service.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/feature_list.h"
 #include "base/rand_util.h"
@@ -18,7 +20,30 @@
 
 namespace brave {
 
-BraveFarblingService::BraveFarblingService() {
+namespace {
+
+constexpr size_t kMaxCachedSeeds = 256;
+
+std::string GetDomain(const GURL& url) {
+  return net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
+
+uint64_t DeriveSeed(const crypto::HMAC& hmac, const std::string& domain) {
+  uint8_t domain_key[32];
+  CHECK(hmac.Sign(domain, domain_key, sizeof domain_key));
+  return *reinterpret_cast<uint64_t*>(domain_key);
+}
+
+void InitHMAC(crypto::HMAC* hmac, uint64_t session_key) {
+  CHECK(hmac->Init(reinterpret_cast<const unsigned char*>(&session_key),
+                   sizeof session_key));
+}
+
+}  // namespace
+
+BraveFarblingService::BraveFarblingService() : seeds_(kMaxCachedSeeds) {
+  base::AutoLock lock(lock_);
   // initialize random seeds for farbling
   session_token_ = base::RandUint64();
   incognito_session_token_ = base::RandUint64();
@@ -27,6 +52,7 @@ BraveFarblingService::BraveFarblingService() {
 BraveFarblingService::~BraveFarblingService() = default;
 
 uint64_t BraveFarblingService::session_token(bool is_off_the_record) {
+  base::AutoLock lock(lock_);
   if (is_off_the_record)
     return incognito_session_token_;
   return session_token_;
@@ -35,6 +61,9 @@ uint64_t BraveFarblingService::session_token(bool is_off_the_record) {
 void BraveFarblingService::set_session_tokens_for_testing(
     uint64_t session_token,
     uint64_t incognito_session_token) {
+  base::AutoLock lock(lock_);
+  // Cached seeds were derived from the old tokens.
+  seeds_.Clear();
   session_token_ = session_token;
   incognito_session_token_ = incognito_session_token;
 }
@@ -43,22 +72,72 @@ bool BraveFarblingService::MakePseudoRandomGeneratorForURL(
     const GURL& url,
     bool is_off_the_record,
     FarblingPRNG* prng) {
-  const std::string domain =
-      net::registry_controlled_domains::GetDomainAndRegistry(
-          url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-  if (domain.empty())
+  const absl::optional<uint64_t> seed = GetSeedForURL(url, is_off_the_record);
+  if (!seed)
     return false;
-  uint8_t domain_key[32];
-  uint64_t session_key = session_token(is_off_the_record);
-  crypto::HMAC h(crypto::HMAC::SHA256);
-  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_key),
-               sizeof session_key));
-  CHECK(h.Sign(domain, domain_key, sizeof domain_key));
-  uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key);
-  *prng = FarblingPRNG(seed);
+  *prng = FarblingPRNG(*seed);
   return true;
 }
 
+std::vector<absl::optional<uint64_t>> BraveFarblingService::GetSeedsForURLs(
+    const std::vector<GURL>& urls,
+    bool is_off_the_record) {
+  // The registry lookups don't need the lock.
+  std::vector<std::string> domains;
+  domains.reserve(urls.size());
+  for (const auto& url : urls) {
+    domains.push_back(GetDomain(url));
+  }
+
+  std::vector<absl::optional<uint64_t>> seeds;
+  seeds.reserve(urls.size());
+
+  base::AutoLock lock(lock_);
+  crypto::HMAC hmac(crypto::HMAC::SHA256);
+  bool hmac_initialized = false;
+  for (auto& domain : domains) {
+    if (domain.empty()) {
+      seeds.push_back(absl::nullopt);
+      continue;
+    }
+    SeedKey key(std::move(domain), is_off_the_record);
+    auto it = seeds_.Get(key);
+    if (it != seeds_.end()) {
+      seeds.push_back(it->second);
+      continue;
+    }
+    if (!hmac_initialized) {
+      InitHMAC(&hmac, is_off_the_record ? incognito_session_token_
+                                        : session_token_);
+      hmac_initialized = true;
+    }
+    const uint64_t seed = DeriveSeed(hmac, key.first);
+    seeds_.Put(std::move(key), seed);
+    seeds.push_back(seed);
+  }
+  return seeds;
+}
+
+absl::optional<uint64_t> BraveFarblingService::GetSeedForURL(
+    const GURL& url,
+    bool is_off_the_record) {
+  SeedKey key(GetDomain(url), is_off_the_record);
+  if (key.first.empty())
+    return absl::nullopt;
+
+  base::AutoLock lock(lock_);
+  auto it = seeds_.Get(key);
+  if (it != seeds_.end())
+    return it->second;
+
+  crypto::HMAC hmac(crypto::HMAC::SHA256);
+  InitHMAC(&hmac,
+           is_off_the_record ? incognito_session_token_ : session_token_);
+  const uint64_t seed = DeriveSeed(hmac, key.first);
+  seeds_.Put(std::move(key), seed);
+  return seed;
+}
+
 // static
 void BraveFarblingService::RegisterProfilePrefs(
     user_prefs::PrefRegistrySyncable* registry) {
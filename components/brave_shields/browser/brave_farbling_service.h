@@ -6,7 +6,15 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BRAVE_FARBLING_SERVICE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BRAVE_FARBLING_SERVICE_H_
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/lru_cache.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "third_party/abseil-cpp/absl/random/random.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 class GURL;
 
@@ -30,11 +38,29 @@ class BraveFarblingService {
                                        bool is_off_the_record,
                                        FarblingPRNG* prng);
 
+  // Returns the farbling seed for each of |urls|, or nullopt for URLs that
+  // have no eTLD+1. Takes the lock and sets up the HMAC key once for the
+  // whole batch.
+  std::vector<absl::optional<uint64_t>> GetSeedsForURLs(
+      const std::vector<GURL>& urls,
+      bool is_off_the_record);
+
   static void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
 
  private:
-  uint64_t session_token_;
-  uint64_t incognito_session_token_;
+  // (eTLD+1, is_off_the_record)
+  using SeedKey = std::pair<std::string, bool>;
+
+  absl::optional<uint64_t> GetSeedForURL(const GURL& url,
+                                         bool is_off_the_record);
+
+  base::Lock lock_;
+  uint64_t session_token_ GUARDED_BY(lock_);
+  uint64_t incognito_session_token_ GUARDED_BY(lock_);
+  // Seeds derived from the current session tokens, keyed by eTLD+1. Every
+  // frame of a site asks for the same seed, so this saves an HMAC per frame.
+  // The eTLD+1 itself is still looked up for every call.
+  base::LRUCache<SeedKey, uint64_t> seeds_ GUARDED_BY(lock_);
 };
 
 }  // namespace brave
@@ -4,9 +4,13 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <memory>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include "brave/components/brave_shields/browser/brave_farbling_service.h"
+#include "crypto/hmac.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/abseil-cpp/absl/random/random.h"
 #include "url/gurl.h"
@@ -16,6 +20,22 @@ const uint64_t kTestSessionToken = 123456789;
 const uint64_t kTestIncognitoSessionToken = 234567890;
 const uint64_t kAnotherTestSessionToken = 45678;
 const uint64_t kAnotherTestIncognitoSessionToken = 56789;
+
+// Derives the seed for |url| the way the service did before seeds were
+// cached.
+absl::optional<uint64_t> UncachedSeed(const GURL& url, uint64_t session_key) {
+  const std::string domain =
+      net::registry_controlled_domains::GetDomainAndRegistry(
+          url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  if (domain.empty())
+    return absl::nullopt;
+  uint8_t domain_key[32];
+  crypto::HMAC h(crypto::HMAC::SHA256);
+  EXPECT_TRUE(h.Init(reinterpret_cast<const unsigned char*>(&session_key),
+                     sizeof session_key));
+  EXPECT_TRUE(h.Sign(domain, domain_key, sizeof domain_key));
+  return *reinterpret_cast<uint64_t*>(domain_key);
+}
 }  // namespace
 
 class BraveFarblingServiceTest : public testing::Test {
@@ -97,3 +117,64 @@ TEST_F(BraveFarblingServiceTest, InvalidDomains) {
         farbling_service()->MakePseudoRandomGeneratorForURL(url, true, &prng));
   }
 }
+
+TEST_F(BraveFarblingServiceTest, CachedSeedsMatchUncached) {
+  const std::vector<GURL> urls = {
+      GURL("https://a.com"),         GURL("https://sub.a.com/path"),
+      GURL("https://b.co.uk"),       GURL("https://user.github.io"),
+      GURL("about:blank"),           GURL("https://a.com"),
+      GURL("http://127.0.0.1:8080"),
+  };
+  for (bool is_off_the_record : {false, true}) {
+    const uint64_t session_key =
+        is_off_the_record ? kTestIncognitoSessionToken : kTestSessionToken;
+    // Run twice so the second pass is served from the cache.
+    for (int pass = 0; pass < 2; ++pass) {
+      for (const auto& url : urls) {
+        SCOPED_TRACE(url.spec());
+        const absl::optional<uint64_t> expected =
+            UncachedSeed(url, session_key);
+        brave::FarblingPRNG prng;
+        ASSERT_EQ(expected.has_value(),
+                  farbling_service()->MakePseudoRandomGeneratorForURL(
+                      url, is_off_the_record, &prng));
+        if (expected) {
+          brave::FarblingPRNG expected_prng(*expected);
+          EXPECT_EQ(expected_prng(), prng());
+        }
+      }
+    }
+
+    const std::vector<absl::optional<uint64_t>> seeds =
+        farbling_service()->GetSeedsForURLs(urls, is_off_the_record);
+    ASSERT_EQ(urls.size(), seeds.size());
+    for (size_t i = 0; i < urls.size(); ++i) {
+      EXPECT_EQ(UncachedSeed(urls[i], session_key), seeds[i]) << urls[i];
+    }
+  }
+}
+
+TEST_F(BraveFarblingServiceTest, BatchedSeedsOnColdCache) {
+  const std::vector<GURL> urls = {GURL("https://a.com"), GURL("https://b.com"),
+                                  GURL("https://www.a.com"), GURL("")};
+  const std::vector<absl::optional<uint64_t>> seeds =
+      farbling_service()->GetSeedsForURLs(urls, false);
+  ASSERT_EQ(4u, seeds.size());
+  EXPECT_EQ(UncachedSeed(urls[0], kTestSessionToken), seeds[0]);
+  EXPECT_EQ(UncachedSeed(urls[1], kTestSessionToken), seeds[1]);
+  EXPECT_EQ(seeds[0], seeds[2]);
+  EXPECT_FALSE(seeds[3]);
+}
+
+TEST_F(BraveFarblingServiceTest, SeedsChangeWithSessionTokens) {
+  const GURL url("https://a.com");
+  const std::vector<absl::optional<uint64_t>> before =
+      farbling_service()->GetSeedsForURLs({url}, false);
+
+  farbling_service()->set_session_tokens_for_testing(
+      kAnotherTestSessionToken, kAnotherTestIncognitoSessionToken);
+  const std::vector<absl::optional<uint64_t>> after =
+      farbling_service()->GetSeedsForURLs({url}, false);
+  EXPECT_NE(before[0], after[0]);
+  EXPECT_EQ(UncachedSeed(url, kAnotherTestSessionToken), after[0]);
+}
@@ -11,6 +11,7 @@
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "brave/components/brave_shields/browser/brave_shields_p3a.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
 #include "brave/components/brave_shields/common/brave_shield_utils.h"
 #include "brave/components/brave_shields/common/features.h"
 #include "brave/components/brave_shields/common/pref_names.h"
@@ -369,6 +370,13 @@ bool ShouldDoReduceLanguage(HostContentSettingsMap* map,
   return true;
 }
 
+bool ShouldDoReduceLanguage(const ShieldsSettingsSnapshot& settings,
+                            PrefService* pref_service) {
+  return IsReduceLanguageEnabledForProfile(pref_service) &&
+         settings.shields_enabled &&
+         settings.fingerprinting_control_type != ControlType::ALLOW;
+}
+
 DomainBlockingType GetDomainBlockingType(HostContentSettingsMap* map,
                                          const GURL& url) {
   // Don't block if feature is disabled
@@ -48,6 +48,7 @@ enum class DomainBlockingType {
 };
 
 struct ShieldsSettingCounts;
+struct ShieldsSettingsSnapshot;
 
 ContentSettingsPattern GetPatternFromURL(const GURL& url);
 std::string ControlTypeToString(ControlType type);
@@ -82,6 +83,8 @@ bool IsReduceLanguageEnabledForProfile(PrefService* pref_service);
 bool ShouldDoReduceLanguage(HostContentSettingsMap* map,
                             const GURL& url,
                             PrefService* pref_service);
+bool ShouldDoReduceLanguage(const ShieldsSettingsSnapshot& settings,
+                            PrefService* pref_service);
 
 DomainBlockingType GetDomainBlockingType(HostContentSettingsMap* map,
                                          const GURL& url);
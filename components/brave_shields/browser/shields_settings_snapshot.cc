@@ -0,0 +1,31 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+// static
+ShieldsSettingsSnapshot ShieldsSettingsSnapshot::Create(
+    HostContentSettingsMap* map,
+    const GURL& url) {
+  ShieldsSettingsSnapshot snapshot;
+  if (!map) {
+    return snapshot;
+  }
+  snapshot.shields_enabled = GetBraveShieldsEnabled(map, url);
+  snapshot.ad_control_type = GetAdControlType(map, url);
+  snapshot.cosmetic_filtering_control_type =
+      GetCosmeticFilteringControlType(map, url);
+  snapshot.fingerprinting_control_type = GetFingerprintingControlType(map, url);
+  snapshot.https_everywhere_enabled = GetHTTPSEverywhereEnabled(map, url);
+  snapshot.referrers_allowed = AreReferrersAllowed(map, url);
+  return snapshot;
+}
+
+}  // namespace brave_shields
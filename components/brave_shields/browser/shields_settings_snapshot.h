@@ -0,0 +1,34 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+
+class GURL;
+class HostContentSettingsMap;
+
+namespace brave_shields {
+
+// The Shields settings that apply to a top-frame URL, resolved together so
+// that request handling code doesn't look each of them up in the
+// HostContentSettingsMap again for every subresource. The defaults are what
+// applies when there is no map.
+struct ShieldsSettingsSnapshot {
+  static ShieldsSettingsSnapshot Create(HostContentSettingsMap* map,
+                                        const GURL& url);
+
+  bool shields_enabled = true;
+  ControlType ad_control_type = ControlType::BLOCK;
+  ControlType cosmetic_filtering_control_type = ControlType::BLOCK_THIRD_PARTY;
+  ControlType fingerprinting_control_type = ControlType::DEFAULT;
+  bool https_everywhere_enabled = true;
+  bool referrers_allowed = false;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
@@ -0,0 +1,89 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_snapshot_cache.h"
+
+#include "base/check.h"
+#include "content/public/browser/web_contents.h"
+
+namespace brave_shields {
+
+namespace {
+
+bool IsShieldsContentSettingsType(ContentSettingsTypeSet content_type_set) {
+  if (content_type_set.ContainsAllTypes()) {
+    return true;
+  }
+  switch (content_type_set.GetType()) {
+    case ContentSettingsType::BRAVE_ADS:
+    case ContentSettingsType::BRAVE_COSMETIC_FILTERING:
+    case ContentSettingsType::BRAVE_FINGERPRINTING_V2:
+    case ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES:
+    case ContentSettingsType::BRAVE_HTTPS_UPGRADE:
+    case ContentSettingsType::BRAVE_REFERRERS:
+    case ContentSettingsType::BRAVE_SHIELDS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+ShieldsSettingsSnapshotCache::ShieldsSettingsSnapshotCache(
+    content::WebContents* web_contents,
+    HostContentSettingsMap* map)
+    : content::WebContentsObserver(web_contents),
+      content::WebContentsUserData<ShieldsSettingsSnapshotCache>(*web_contents),
+      map_(map) {
+  DCHECK(map_);
+  observation_.Observe(map_);
+}
+
+ShieldsSettingsSnapshotCache::~ShieldsSettingsSnapshotCache() = default;
+
+// static
+ShieldsSettingsSnapshotCache* ShieldsSettingsSnapshotCache::GetOrCreate(
+    content::WebContents* web_contents,
+    HostContentSettingsMap* map) {
+  ShieldsSettingsSnapshotCache::CreateForWebContents(web_contents, map);
+  return ShieldsSettingsSnapshotCache::FromWebContents(web_contents);
+}
+
+const ShieldsSettingsSnapshot& ShieldsSettingsSnapshotCache::Get(
+    int frame_tree_node_id,
+    const GURL& top_frame_url) {
+  auto it = entries_.find(frame_tree_node_id);
+  if (it == entries_.end()) {
+    it = entries_.emplace(frame_tree_node_id, Entry()).first;
+  } else if (it->second.top_frame_url == top_frame_url) {
+    return it->second.settings;
+  }
+  it->second.top_frame_url = top_frame_url;
+  it->second.settings = ShieldsSettingsSnapshot::Create(map_, top_frame_url);
+  return it->second.settings;
+}
+
+void ShieldsSettingsSnapshotCache::FrameDeleted(int frame_tree_node_id) {
+  entries_.erase(frame_tree_node_id);
+}
+
+void ShieldsSettingsSnapshotCache::WebContentsDestroyed() {
+  observation_.Reset();
+  entries_.clear();
+}
+
+void ShieldsSettingsSnapshotCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  if (IsShieldsContentSettingsType(content_type_set)) {
+    entries_.clear();
+  }
+}
+
+WEB_CONTENTS_USER_DATA_KEY_IMPL(ShieldsSettingsSnapshotCache);
+
+}  // namespace brave_shields
@@ -0,0 +1,79 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_CACHE_H_
+
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ptr.h"
+#include "base/scoped_observation.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/browser/web_contents_observer.h"
+#include "content/public/browser/web_contents_user_data.h"
+#include "url/gurl.h"
+
+namespace content {
+class WebContents;
+}  // namespace content
+
+namespace brave_shields {
+
+// Per tab cache of ShieldsSettingsSnapshot, keyed by frame tree node. An entry
+// is resolved again when the frame's top-frame URL changes, and the whole
+// cache is dropped when any Shields content setting changes.
+class ShieldsSettingsSnapshotCache
+    : public content::WebContentsObserver,
+      public content::WebContentsUserData<ShieldsSettingsSnapshotCache>,
+      public content_settings::Observer {
+ public:
+  ~ShieldsSettingsSnapshotCache() override;
+
+  ShieldsSettingsSnapshotCache(const ShieldsSettingsSnapshotCache&) = delete;
+  ShieldsSettingsSnapshotCache& operator=(const ShieldsSettingsSnapshotCache&) =
+      delete;
+
+  // Returns the cache associated to |web_contents|, or creates one that reads
+  // from |map| if there is none.
+  static ShieldsSettingsSnapshotCache* GetOrCreate(
+      content::WebContents* web_contents,
+      HostContentSettingsMap* map);
+
+  const ShieldsSettingsSnapshot& Get(int frame_tree_node_id,
+                                     const GURL& top_frame_url);
+
+ private:
+  friend class content::WebContentsUserData<ShieldsSettingsSnapshotCache>;
+
+  struct Entry {
+    GURL top_frame_url;
+    ShieldsSettingsSnapshot settings;
+  };
+
+  ShieldsSettingsSnapshotCache(content::WebContents* web_contents,
+                               HostContentSettingsMap* map);
+
+  // content::WebContentsObserver:
+  void FrameDeleted(int frame_tree_node_id) override;
+  void WebContentsDestroyed() override;
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(
+      const ContentSettingsPattern& primary_pattern,
+      const ContentSettingsPattern& secondary_pattern,
+      ContentSettingsTypeSet content_type_set) override;
+
+  raw_ptr<HostContentSettingsMap> map_ = nullptr;
+  base::flat_map<int, Entry> entries_;
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      observation_{this};
+
+  WEB_CONTENTS_USER_DATA_KEY_DECL();
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_CACHE_H_
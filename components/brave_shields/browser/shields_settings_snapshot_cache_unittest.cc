@@ -0,0 +1,82 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_snapshot_cache.h"
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/chrome_render_view_host_test_harness.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/browser/web_contents.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+class ShieldsSettingsSnapshotCacheTest
+    : public ChromeRenderViewHostTestHarness {
+ public:
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(profile());
+  }
+
+  ShieldsSettingsSnapshotCache* cache() {
+    return ShieldsSettingsSnapshotCache::GetOrCreate(web_contents(), map());
+  }
+
+  int frame_tree_node_id() {
+    return web_contents()->GetPrimaryMainFrame()->GetFrameTreeNodeId();
+  }
+};
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, SnapshotMatchesGetters) {
+  const GURL url("https://brave.com");
+  SetAdControlType(map(), ControlType::ALLOW, url);
+  SetCosmeticFilteringControlType(map(), ControlType::BLOCK, url);
+  SetFingerprintingControlType(map(), ControlType::ALLOW, url);
+  SetHTTPSEverywhereEnabled(map(), false, url);
+
+  const auto snapshot = ShieldsSettingsSnapshot::Create(map(), url);
+  EXPECT_EQ(GetBraveShieldsEnabled(map(), url), snapshot.shields_enabled);
+  EXPECT_EQ(ControlType::ALLOW, snapshot.ad_control_type);
+  EXPECT_EQ(ControlType::BLOCK, snapshot.cosmetic_filtering_control_type);
+  EXPECT_EQ(ControlType::ALLOW, snapshot.fingerprinting_control_type);
+  EXPECT_FALSE(snapshot.https_everywhere_enabled);
+  EXPECT_EQ(AreReferrersAllowed(map(), url), snapshot.referrers_allowed);
+
+  // Without a map, the defaults apply.
+  const auto defaults = ShieldsSettingsSnapshot::Create(nullptr, url);
+  EXPECT_TRUE(defaults.shields_enabled);
+  EXPECT_EQ(ControlType::BLOCK, defaults.ad_control_type);
+}
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, CachesPerTopFrameURL) {
+  const GURL url("https://brave.com");
+  const GURL other_url("https://example.com");
+  SetAdControlType(map(), ControlType::ALLOW, other_url);
+
+  EXPECT_EQ(ControlType::BLOCK,
+            cache()->Get(frame_tree_node_id(), url).ad_control_type);
+  EXPECT_EQ(ControlType::ALLOW,
+            cache()->Get(frame_tree_node_id(), other_url).ad_control_type);
+  EXPECT_EQ(ControlType::BLOCK,
+            cache()->Get(frame_tree_node_id(), url).ad_control_type);
+}
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, InvalidatedBySettingChanges) {
+  const GURL url("https://brave.com");
+  EXPECT_TRUE(cache()->Get(frame_tree_node_id(), url).shields_enabled);
+
+  SetBraveShieldsEnabled(map(), false, url);
+  EXPECT_FALSE(cache()->Get(frame_tree_node_id(), url).shields_enabled);
+
+  SetFingerprintingControlType(map(), ControlType::BLOCK, url);
+  EXPECT_EQ(
+      ControlType::BLOCK,
+      cache()->Get(frame_tree_node_id(), url).fingerprinting_control_type);
+}
+
+}  // namespace brave_shields
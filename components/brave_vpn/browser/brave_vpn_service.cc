@@ -25,6 +25,7 @@
 #include "brave/components/brave_vpn/common/pref_names.h"
 #include "brave/components/p3a_utils/feature_usage.h"
 #include "brave/components/skus/browser/skus_utils.h"
+#include "brave/components/time_period_storage/monthly_storage.h"
 #include "brave/components/version_info/version_info.h"
 #include "components/grit/brave_components_strings.h"
 #include "components/prefs/pref_service.h"
@@ -686,6 +687,10 @@ void BraveVpnService::RecordAndroidBackgroundP3A(int64_t session_start_time_ms,
   base::Time session_end_time =
       base::Time::FromJsTime(static_cast<double>(session_end_time_ms))
           .LocalMidnight();
+  // Shared by every day of the session so that they are written to prefs
+  // together.
+  MonthlyStorage days_in_month_storage(local_prefs_,
+                                       prefs::kBraveVPNDaysInMonthUsed);
   for (base::Time day = session_start_time; day <= session_end_time;
        day += base::Days(1)) {
     bool is_last_day = day == session_end_time;
@@ -698,9 +703,8 @@ void BraveVpnService::RecordAndroidBackgroundP3A(int64_t session_start_time_ms,
         prefs::kBraveVPNUsedSecondDay, kNewUserReturningHistogramName,
         is_last_day);
     p3a_utils::RecordFeatureDaysInMonthUsed(
-        local_prefs_, day, prefs::kBraveVPNLastUseTime,
-        prefs::kBraveVPNDaysInMonthUsed, kDaysInMonthUsedHistogramName,
-        is_last_day);
+        local_prefs_, &days_in_month_storage, day, prefs::kBraveVPNLastUseTime,
+        kDaysInMonthUsedHistogramName, is_last_day);
   }
   p3a_utils::RecordFeatureLastUsageTimeMetric(
       local_prefs_, prefs::kBraveVPNLastUseTime, kLastUsageTimeHistogramName);
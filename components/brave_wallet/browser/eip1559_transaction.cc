@@ -275,19 +275,19 @@ std::vector<uint8_t> Eip1559Transaction::GetMessageToSign(uint256_t chain_id,
   std::vector<uint8_t> result;
   result.push_back(type_);
 
-  base::Value::List list;
-  list.Append(RLPUint256ToBlob(chain_id_));
-  list.Append(RLPUint256ToBlob(nonce_.value()));
-  list.Append(RLPUint256ToBlob(max_priority_fee_per_gas_));
-  list.Append(RLPUint256ToBlob(max_fee_per_gas_));
-  list.Append(RLPUint256ToBlob(gas_limit_));
-  list.Append(base::Value::BlobStorage(to_.bytes()));
-  list.Append(RLPUint256ToBlob(value_));
-  list.Append(base::Value(data_));
-  list.Append(base::Value(AccessListToValue(access_list_)));
-
-  const std::string rlp_msg = RLPEncode(base::Value(std::move(list)));
-  result.insert(result.end(), rlp_msg.begin(), rlp_msg.end());
+  RLPWriter writer(&result);
+  writer.BeginList();
+  writer.AppendUint256(chain_id_);
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(max_priority_fee_per_gas_);
+  writer.AppendUint256(max_fee_per_gas_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to_.bytes());
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  WriteAccessList(access_list_, &writer);
+  writer.EndList();
+
   return hash ? KeccakHash(result) : result;
 }
 
@@ -344,25 +344,24 @@ uint256_t Eip1559Transaction::GetUpfrontCost(uint256_t block_base_fee) const {
 }
 
 std::vector<uint8_t> Eip1559Transaction::Serialize() const {
-  base::Value::List list;
-  list.Append(RLPUint256ToBlob(chain_id_));
-  list.Append(RLPUint256ToBlob(nonce_.value()));
-  list.Append(RLPUint256ToBlob(max_priority_fee_per_gas_));
-  list.Append(RLPUint256ToBlob(max_fee_per_gas_));
-  list.Append(RLPUint256ToBlob(gas_limit_));
-  list.Append(base::Value::BlobStorage(to_.bytes()));
-  list.Append(RLPUint256ToBlob(value_));
-  list.Append(base::Value(data_));
-  list.Append(base::Value(AccessListToValue(access_list_)));
-  list.Append(RLPUint256ToBlob(v_));
-  list.Append(base::Value(r_));
-  list.Append(base::Value(s_));
-
   std::vector<uint8_t> result;
   result.push_back(type_);
 
-  const std::string rlp_msg = RLPEncode(base::Value(std::move(list)));
-  result.insert(result.end(), rlp_msg.begin(), rlp_msg.end());
+  RLPWriter writer(&result);
+  writer.BeginList();
+  writer.AppendUint256(chain_id_);
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(max_priority_fee_per_gas_);
+  writer.AppendUint256(max_fee_per_gas_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to_.bytes());
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  WriteAccessList(access_list_, &writer);
+  writer.AppendUint256(v_);
+  writer.AppendBytes(r_);
+  writer.AppendBytes(s_);
+  writer.EndList();
 
   return result;
 }
@@ -140,6 +140,23 @@ base::Value::List Eip2930Transaction::AccessListToValue(
   return access_list;
 }
 
+// static
+void Eip2930Transaction::WriteAccessList(const AccessList& list,
+                                         RLPWriter* writer) {
+  writer->BeginList();
+  for (const AccessListItem& item : list) {
+    writer->BeginList();
+    writer->AppendBytes(item.address);
+    writer->BeginList();
+    for (const AccessedStorageKey& key : item.storage_keys) {
+      writer->AppendBytes(key);
+    }
+    writer->EndList();
+    writer->EndList();
+  }
+  writer->EndList();
+}
+
 // static
 absl::optional<Eip2930Transaction::AccessList>
 Eip2930Transaction::ValueToAccessList(const base::Value::List& value) {
@@ -166,18 +183,18 @@ std::vector<uint8_t> Eip2930Transaction::GetMessageToSign(uint256_t chain_id,
   std::vector<uint8_t> result;
   result.push_back(type_);
 
-  base::Value::List list;
-  list.Append(RLPUint256ToBlob(chain_id_));
-  list.Append(RLPUint256ToBlob(nonce_.value()));
-  list.Append(RLPUint256ToBlob(gas_price_));
-  list.Append(RLPUint256ToBlob(gas_limit_));
-  list.Append(base::Value::BlobStorage(to_.bytes()));
-  list.Append(RLPUint256ToBlob(value_));
-  list.Append(base::Value(data_));
-  list.Append(base::Value(AccessListToValue(access_list_)));
-
-  const std::string rlp_msg = RLPEncode(base::Value(std::move(list)));
-  result.insert(result.end(), rlp_msg.begin(), rlp_msg.end());
+  RLPWriter writer(&result);
+  writer.BeginList();
+  writer.AppendUint256(chain_id_);
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to_.bytes());
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  WriteAccessList(access_list_, &writer);
+  writer.EndList();
+
   return hash ? KeccakHash(result) : result;
 }
 
@@ -225,24 +242,23 @@ uint256_t Eip2930Transaction::GetDataFee() const {
 }
 
 std::vector<uint8_t> Eip2930Transaction::Serialize() const {
-  base::Value::List list;
-  list.Append(RLPUint256ToBlob(chain_id_));
-  list.Append(RLPUint256ToBlob(nonce_.value()));
-  list.Append(RLPUint256ToBlob(gas_price_));
-  list.Append(RLPUint256ToBlob(gas_limit_));
-  list.Append(base::Value::BlobStorage(to_.bytes()));
-  list.Append(RLPUint256ToBlob(value_));
-  list.Append(base::Value(data_));
-  list.Append(base::Value(AccessListToValue(access_list_)));
-  list.Append(RLPUint256ToBlob(v_));
-  list.Append(base::Value(r_));
-  list.Append(base::Value(s_));
-
   std::vector<uint8_t> result;
   result.push_back(type_);
 
-  const std::string rlp_msg = RLPEncode(base::Value(std::move(list)));
-  result.insert(result.end(), rlp_msg.begin(), rlp_msg.end());
+  RLPWriter writer(&result);
+  writer.BeginList();
+  writer.AppendUint256(chain_id_);
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to_.bytes());
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  WriteAccessList(access_list_, &writer);
+  writer.AppendUint256(v_);
+  writer.AppendBytes(r_);
+  writer.AppendBytes(s_);
+  writer.EndList();
 
   return result;
 }
@@ -15,6 +15,8 @@
 
 namespace brave_wallet {
 
+class RLPWriter;
+
 class Eip2930Transaction : public EthTransaction {
  public:
   typedef std::array<uint8_t, 20> AccessedAddress;
@@ -82,6 +84,9 @@ class Eip2930Transaction : public EthTransaction {
                      const std::vector<uint8_t>& data,
                      uint256_t chain_id);
 
+  // Writes |list| in the rlp form shown above AccessList.
+  static void WriteAccessList(const AccessList& list, RLPWriter* writer);
+
   uint256_t chain_id_;
   AccessList access_list_;
 
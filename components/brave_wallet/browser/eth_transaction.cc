@@ -173,35 +173,36 @@ absl::optional<EthTransaction> EthTransaction::FromValue(
 std::vector<uint8_t> EthTransaction::GetMessageToSign(uint256_t chain_id,
                                                       bool hash) const {
   DCHECK(nonce_);
-  base::Value::List list;
-  list.Append(RLPUint256ToBlob(nonce_.value()));
-  list.Append(RLPUint256ToBlob(gas_price_));
-  list.Append(RLPUint256ToBlob(gas_limit_));
-  list.Append(base::Value::BlobStorage(to_.bytes()));
-  list.Append(RLPUint256ToBlob(value_));
-  list.Append(base::Value(data_));
+  std::vector<uint8_t> result;
+  RLPWriter writer(&result);
+  writer.BeginList();
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to_.bytes());
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
   if (chain_id) {
-    list.Append(RLPUint256ToBlob(chain_id));
-    list.Append(RLPUint256ToBlob(0));
-    list.Append(RLPUint256ToBlob(0));
+    writer.AppendUint256(chain_id);
+    writer.AppendUint256(0);
+    writer.AppendUint256(0);
   }
+  writer.EndList();
 
-  const std::string message = RLPEncode(base::Value(std::move(list)));
-  auto result = std::vector<uint8_t>(message.begin(), message.end());
   return hash ? KeccakHash(result) : result;
 }
 
 std::string EthTransaction::GetSignedTransaction() const {
   DCHECK(nonce_);
 
-  return ToHex(RLPEncode(Serialize()));
+  return ToHex(Serialize());
 }
 
 std::string EthTransaction::GetTransactionHash() const {
   DCHECK(IsSigned());
   DCHECK(nonce_);
 
-  return KeccakHash(RLPEncode(Serialize()));
+  return ToHex(KeccakHash(Serialize()));
 }
 
 bool EthTransaction::ProcessVRS(const std::string& v,
@@ -297,19 +298,22 @@ uint256_t EthTransaction::GetUpfrontCost(uint256_t block_base_fee) const {
   return gas_limit_ * gas_price_ + value_;
 }
 
-base::Value EthTransaction::Serialize() const {
-  base::Value::List list;
-  list.Append(RLPUint256ToBlob(nonce_.value()));
-  list.Append(RLPUint256ToBlob(gas_price_));
-  list.Append(RLPUint256ToBlob(gas_limit_));
-  list.Append(base::Value::BlobStorage(to_.bytes()));
-  list.Append(RLPUint256ToBlob(value_));
-  list.Append(base::Value(data_));
-  list.Append(RLPUint256ToBlob(v_));
-  list.Append(base::Value(r_));
-  list.Append(base::Value(s_));
-
-  return base::Value(std::move(list));
+std::vector<uint8_t> EthTransaction::Serialize() const {
+  std::vector<uint8_t> result;
+  RLPWriter writer(&result);
+  writer.BeginList();
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to_.bytes());
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  writer.AppendUint256(v_);
+  writer.AppendBytes(r_);
+  writer.AppendBytes(s_);
+  writer.EndList();
+
+  return result;
 }
 
 }  // namespace brave_wallet
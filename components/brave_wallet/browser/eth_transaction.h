@@ -122,7 +122,8 @@ class EthTransaction {
   FRIEND_TEST_ALL_PREFIXES(Eip2930TransactionUnitTest,
                            GetSignedTransactionAndHash);
 
-  base::Value Serialize() const;
+  // RLP encoding of the signed transaction.
+  std::vector<uint8_t> Serialize() const;
 };
 
 }  // namespace brave_wallet
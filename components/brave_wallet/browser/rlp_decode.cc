@@ -9,174 +9,127 @@
 
 namespace {
 
-// Decodes an integer
-bool RLPToInteger(const std::string& s, size_t* val) {
-  size_t length = s.length();
-  if (length == 0) {
+// Decodes a big-endian length without leading zeros.
+bool RLPToLength(base::span<const uint8_t> bytes, size_t* length) {
+  if (bytes.empty() || bytes.size() > sizeof(size_t) || bytes[0] == 0) {
     return false;
   }
-
-  if (length == 1) {
-    *val = static_cast<size_t>(static_cast<uint8_t>(s[0]));
-    return true;
-  }
-
-  size_t v2;
-  if (length <= 1 || !RLPToInteger(s.substr(0, length - 1), &v2)) {
-    return false;
+  size_t result = 0;
+  for (uint8_t byte : bytes) {
+    result = (result << 8) | byte;
   }
-  *val = static_cast<size_t>(static_cast<uint8_t>(s[length - 1]) + v2 * 256);
+  *length = result;
   return true;
 }
 
-bool IsWithinBounds(size_t offset, size_t data_len, size_t length) {
-  // This seems redundant but it is resistant to overflows
-  return offset <= length && data_len <= length && offset + data_len <= length;
-}
-
-// Decodes an offset, length, and value
-bool RLPDecodeLength(const std::string& s,
-                     size_t* offset,
-                     size_t* data_len,
-                     base::Value* value) {
-  size_t length = s.length();
-  if (length == 0) {
+bool RLPDecodeValue(brave_wallet::RLPReader* reader, base::Value* output) {
+  brave_wallet::RLPReader::Type type;
+  base::span<const uint8_t> payload;
+  if (!reader->Read(&type, &payload)) {
     return false;
   }
-  uint8_t prefix = static_cast<uint8_t>(s[0]);
-  if (prefix <= 0x7f) {
-    *offset = 0;
-    *data_len = 1;
-    std::string str = {s[0]};
-    *value = base::Value(str);
+  if (type == brave_wallet::RLPReader::Type::kBytes) {
+    *output = base::Value(std::string(payload.begin(), payload.end()));
     return true;
   }
-
-  if (prefix <= 0xb7 && length > prefix - 0x80) {
-    size_t strLen = prefix - 0x80;
-    *offset = 1;
-    *data_len = strLen;
-    if (!IsWithinBounds(*offset, *data_len, length)) {
+  base::Value::List list;
+  brave_wallet::RLPReader list_reader(payload);
+  while (!list_reader.empty()) {
+    base::Value item;
+    if (!RLPDecodeValue(&list_reader, &item)) {
       return false;
     }
-    // If a string length is 1 it should have been handled by the single byte
-    // clause above.
-    if (*data_len == 1) {
-      return false;
-    }
-    std::string str = s.substr(*offset, *data_len);
-    *value = base::Value(str);
-    return true;
+    list.Append(std::move(item));
   }
+  *output = base::Value(std::move(list));
+  return true;
+}
 
-  size_t i;
-  if (1 + prefix - 0xb7 <= length &&
-      RLPToInteger(s.substr(1, prefix - 0xb7), &i)) {
-    if (prefix <= 0xbf && length > prefix - 0xb7 &&
-        length > prefix - 0xb7 + i) {
-      size_t strLen = i;
-      *offset = 1 + prefix - 0xb7;
-      *data_len = strLen;
-      if (!IsWithinBounds(*offset, *data_len, length)) {
-        return false;
-      }
-      // If a list contains 0-55 bytes, it should have been handled above by
-      // the RLP encoding spec.  So this input should never happen, even though
-      // it could in theory decode properly.
-      if (*data_len <= 55) {
-        return false;
-      }
-
-      std::string str = s.substr(*offset, *data_len);
-      *value = base::Value(str);
-      return true;
-    }
-  }
+}  // namespace
 
-  if (prefix <= 0xf7 && length > prefix - 0xc0) {
-    *offset = 1;
-    *data_len = prefix - 0xc0;
-    *value = base::Value(base::Value::Type::LIST);
+namespace brave_wallet {
+
+RLPReader::RLPReader(base::span<const uint8_t> data) : data_(data) {}
+
+RLPReader::~RLPReader() = default;
+
+bool RLPReader::Read(Type* type, base::span<const uint8_t>* payload) {
+  if (data_.empty()) {
+    return false;
+  }
+  const uint8_t prefix = data_[0];
+  if (prefix < 0x80) {
+    *type = Type::kBytes;
+    *payload = data_.first(1);
+    data_ = data_.subspan(1);
     return true;
   }
 
-  // The data is a list if the range of the first byte is [0xf8, 0xff], and the
-  // total payload of the list whose length is equal to the first byte minus
-  // 0xf7 follows the first byte, and the concatenation of the RLP encodings
-  // of all items of the list follows the total payload of the list;
-  size_t list_data_len;
-  size_t list_len_length = prefix - 0xf7;
-  if (prefix <= 0xff && length >= 1 + prefix - 0xf7 &&
-      RLPToInteger(s.substr(1, list_len_length), &list_data_len)) {
-    // Skip past the prefix and the list len length
-    *offset = 1 + list_len_length;
-    *data_len = list_data_len;
-    // If a list contains 0-55 elements, it should have been handled above by
-    // the RLP encoding spec.  So this input should never happen, even though
-    // it could in theory decode properly.
-    if (*data_len <= 55 || !IsWithinBounds(*offset, *data_len, length)) {
+  *type = prefix < 0xc0 ? Type::kBytes : Type::kList;
+  const uint8_t short_base = prefix < 0xc0 ? 0x80 : 0xc0;
+  const uint8_t long_base = prefix < 0xc0 ? 0xb7 : 0xf7;
+  size_t header_length = 1;
+  size_t payload_length;
+  if (prefix <= long_base) {
+    payload_length = prefix - short_base;
+  } else {
+    const size_t length_length = prefix - long_base;
+    if (data_.size() <= length_length ||
+        !RLPToLength(data_.subspan(1, length_length), &payload_length) ||
+        // Payloads shorter than 56 bytes must use the short form.
+        payload_length < 56) {
       return false;
     }
-    *value = base::Value(base::Value::Type::LIST);
-    return true;
+    header_length += length_length;
+  }
+  // Written this way to be resistant to overflows.
+  if (payload_length > data_.size() - header_length) {
+    return false;
   }
+  *payload = data_.subspan(header_length, payload_length);
+  // Single bytes below 0x80 must be encoded as themselves.
+  if (*type == Type::kBytes && payload_length == 1 && (*payload)[0] < 0x80) {
+    return false;
+  }
+  data_ = data_.subspan(header_length + payload_length);
+  return true;
+}
 
-  return false;
+bool RLPReader::ReadBytes(base::span<const uint8_t>* bytes) {
+  Type type;
+  return Read(&type, bytes) && type == Type::kBytes;
 }
 
-// Decodes a string and gives the result, an offset, and a data_len
-bool RLPDecodeInternal(const std::string& s,
-                       base::Value* output,
-                       size_t* offset,
-                       size_t* data_len) {
-  size_t length = s.length();
-  if (!RLPDecodeLength(s, offset, data_len, output)) {
+bool RLPReader::ReadUint256(uint256_t* value) {
+  base::span<const uint8_t> bytes;
+  if (!ReadBytes(&bytes) || bytes.size() > 32 ||
+      (!bytes.empty() && bytes[0] == 0)) {
     return false;
   }
-
-  if (output->is_string()) {
-    if (!IsWithinBounds(*offset, *data_len, length)) {
-      return false;
-    }
-    std::string str = s.substr(*offset, *data_len);
-    *output = base::Value(str);
-  } else if (output->is_list()) {
-    base::Value::List list;
-    if (!IsWithinBounds(*offset, *data_len, length)) {
-      return false;
-    }
-    std::string sub = s.substr(*offset, *data_len);
-    while (sub.length() > 0) {
-      base::Value v;
-      size_t offset2, data_len2;
-      if (!RLPDecodeInternal(sub, &v, &offset2, &data_len2)) {
-        return false;
-      }
-      list.Append(std::move(v));
-      *offset += data_len2 + offset2;
-      *data_len -= data_len2 + offset2;
-      if (!IsWithinBounds(*offset, *data_len, length)) {
-        return false;
-      }
-      sub = s.substr(*offset, *data_len);
-    }
-    *output = base::Value(std::move(list));
+  uint256_t result = 0;
+  for (uint8_t byte : bytes) {
+    result = (result << 8) | static_cast<uint256_t>(byte);
   }
-
+  *value = result;
   return true;
 }
 
-}  // namespace
-
-namespace brave_wallet {
+bool RLPReader::ReadList(RLPReader* list) {
+  Type type;
+  base::span<const uint8_t> payload;
+  if (!Read(&type, &payload) || type != Type::kList) {
+    return false;
+  }
+  *list = RLPReader(payload);
+  return true;
+}
 
 bool RLPDecode(const std::string& s, base::Value* output) {
   if (!output) {
     return false;
   }
-  size_t offset;
-  size_t data_len;
-  bool result = RLPDecodeInternal(s, output, &offset, &data_len);
+  RLPReader reader(base::as_bytes(base::make_span(s)));
+  bool result = RLPDecodeValue(&reader, output);
   if (!result) {
     *output = base::Value();
   }
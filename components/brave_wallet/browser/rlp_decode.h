@@ -8,12 +8,40 @@
 
 #include <string>
 
+#include "base/containers/span.h"
 #include "base/values.h"
+#include "brave/components/brave_wallet/common/brave_wallet_types.h"
 
 namespace brave_wallet {
 
+// Reads Recursive Length Prefix (RLP) encoded items from |data| without
+// copying. Returned spans point into |data|, which must outlive them. Only
+// canonical encodings are accepted.
+class RLPReader {
+ public:
+  enum class Type { kBytes, kList };
+
+  explicit RLPReader(base::span<const uint8_t> data);
+  ~RLPReader();
+
+  bool empty() const { return data_.empty(); }
+
+  // Reads the next item of either type. For lists |payload| holds the
+  // encoded elements, which can be read with another RLPReader.
+  bool Read(Type* type, base::span<const uint8_t>* payload);
+
+  bool ReadBytes(base::span<const uint8_t>* bytes);
+  // Fails for values with leading zeros or longer than 32 bytes.
+  bool ReadUint256(uint256_t* value);
+  bool ReadList(RLPReader* list);
+
+ private:
+  base::span<const uint8_t> data_;
+};
+
 // Recursive Length Prefix (RLP) decoding of arbitrarily nested arrays of data
-// Input string should be a hex string but without the 0x prefix
+// Input string should be a hex string but without the 0x prefix. Prefer
+// RLPReader in new code.
 bool RLPDecode(const std::string& s, base::Value* output);
 
 }  // namespace brave_wallet
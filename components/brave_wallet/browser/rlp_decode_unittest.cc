@@ -392,4 +392,56 @@ TEST(RLPDecodeTest, InvalidInputLessThanLongLengthList2) {
   ASSERT_TRUE(val.is_none());
 }
 
+TEST(RLPDecodeTest, SingleByteAbove7f) {
+  base::Value val;
+  ASSERT_TRUE(RLPDecode(FromHex("0x8180"), &val));
+  ASSERT_TRUE(val.is_string());
+  EXPECT_EQ(std::string(1, '\x80'), val.GetString());
+
+  // A single byte below 0x80 must be encoded as itself.
+  EXPECT_FALSE(RLPDecode(FromHex("0x817f"), &val));
+}
+
+TEST(RLPDecodeTest, Reader) {
+  // [[1, 0x0400], 'cat', '']
+  const std::string input = FromHex("0xcac4018204008363617480");
+  RLPReader reader(base::as_bytes(base::make_span(input)));
+  RLPReader list({});
+  ASSERT_TRUE(reader.ReadList(&list));
+  EXPECT_TRUE(reader.empty());
+
+  RLPReader inner({});
+  ASSERT_TRUE(list.ReadList(&inner));
+  uint256_t value = 0;
+  ASSERT_TRUE(inner.ReadUint256(&value));
+  EXPECT_EQ(value, uint256_t(1));
+  ASSERT_TRUE(inner.ReadUint256(&value));
+  EXPECT_EQ(value, uint256_t(0x0400));
+  EXPECT_TRUE(inner.empty());
+  EXPECT_FALSE(inner.ReadUint256(&value));
+
+  base::span<const uint8_t> bytes;
+  ASSERT_TRUE(list.ReadBytes(&bytes));
+  EXPECT_EQ("cat", std::string(bytes.begin(), bytes.end()));
+  ASSERT_TRUE(list.ReadUint256(&value));
+  EXPECT_EQ(value, uint256_t(0));
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(RLPDecodeTest, ReaderRejectsNonCanonicalIntegers) {
+  uint256_t value = 0;
+  // Leading zero.
+  std::string input = FromHex("0x820001");
+  EXPECT_FALSE(
+      RLPReader(base::as_bytes(base::make_span(input))).ReadUint256(&value));
+  // Longer than 32 bytes.
+  input = FromHex("0xa1") + std::string(33, '\x01');
+  EXPECT_FALSE(
+      RLPReader(base::as_bytes(base::make_span(input))).ReadUint256(&value));
+  // A list is not an integer.
+  input = FromHex("0xc0");
+  EXPECT_FALSE(
+      RLPReader(base::as_bytes(base::make_span(input))).ReadUint256(&value));
+}
+
 }  // namespace brave_wallet
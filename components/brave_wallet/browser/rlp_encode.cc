@@ -6,36 +6,101 @@
 #include "brave/components/brave_wallet/browser/rlp_encode.h"
 
 #include <algorithm>
-#include <utility>
+
+#include "base/check.h"
 
 namespace {
 
-std::string RLPToBinary(size_t x) {
-  if (x == 0) {
-    return "";
+// Number of bytes needed to write |x| big-endian without leading zeros.
+size_t RLPBinaryLength(size_t x) {
+  size_t length = 0;
+  for (; x; x >>= 8) {
+    ++length;
   }
-  std::string ret = RLPToBinary(x / 256);
-  ret.push_back(x % 256);
-  return ret;
+  return length;
 }
 
-std::string RLPEncodeLength(size_t length, size_t offset) {
-  char sz[2] = {0};
+// Writes the prefix of an item whose payload is |length| bytes long to
+// |header| and returns the prefix size (at most 9 bytes).
+size_t RLPEncodeLength(size_t length, uint8_t offset, uint8_t* header) {
   if (length < 56) {
-    sz[0] = length + offset;
-    return sz;
+    header[0] = static_cast<uint8_t>(length + offset);
+    return 1;
+  }
+  const size_t binary_length = RLPBinaryLength(length);
+  header[0] = static_cast<uint8_t>(binary_length + offset + 55);
+  for (size_t i = binary_length; i > 0; --i, length >>= 8) {
+    header[i] = static_cast<uint8_t>(length & 0xFF);
+  }
+  return binary_length + 1;
+}
+
+void RLPWriteValue(const base::Value& val, brave_wallet::RLPWriter* writer) {
+  if (val.is_int()) {
+    writer->AppendUint256(static_cast<brave_wallet::uint256_t>(val.GetInt()));
+  } else if (val.is_blob()) {
+    writer->AppendBytes(val.GetBlob());
+  } else if (val.is_string()) {
+    writer->AppendBytes(base::as_bytes(base::make_span(val.GetString())));
+  } else if (val.is_list()) {
+    writer->BeginList();
+    for (const auto& item : val.GetList()) {
+      RLPWriteValue(item, writer);
+    }
+    writer->EndList();
   }
-  std::string BL = RLPToBinary(length);
-  sz[0] = BL.length() + offset + 55;
-  std::string ret(sz);
-  ret.append(BL);
-  return ret;
 }
 
 }  // namespace
 
 namespace brave_wallet {
 
+RLPWriter::RLPWriter(std::vector<uint8_t>* output) : output_(output) {
+  DCHECK(output_);
+}
+
+RLPWriter::~RLPWriter() {
+  DCHECK(open_lists_.empty());
+}
+
+void RLPWriter::AppendBytes(base::span<const uint8_t> bytes) {
+  if (bytes.size() == 1 && bytes[0] < 0x80) {
+    output_->push_back(bytes[0]);
+    return;
+  }
+  uint8_t header[9];
+  const size_t header_length = RLPEncodeLength(bytes.size(), 0x80, header);
+  output_->insert(output_->end(), header, header + header_length);
+  output_->insert(output_->end(), bytes.begin(), bytes.end());
+}
+
+void RLPWriter::AppendUint256(uint256_t value) {
+  uint8_t bytes[32];
+  size_t length = 0;
+  for (; value > static_cast<uint256_t>(0); value >>= 8) {
+    bytes[31 - length++] =
+        static_cast<uint8_t>(value & static_cast<uint256_t>(0xFF));
+  }
+  AppendBytes(base::make_span(bytes).last(length));
+}
+
+void RLPWriter::BeginList() {
+  open_lists_.push_back(output_->size());
+}
+
+void RLPWriter::EndList() {
+  DCHECK(!open_lists_.empty());
+  const size_t payload_offset = open_lists_.back();
+  open_lists_.pop_back();
+  // The payload size is only known now, so the prefix is inserted in front of
+  // the already written payload.
+  uint8_t header[9];
+  const size_t header_length = RLPEncodeLength(
+      output_->size() - payload_offset, 0xc0, header);
+  output_->insert(output_->begin() + payload_offset, header,
+                  header + header_length);
+}
+
 base::Value::BlobStorage RLPUint256ToBlob(uint256_t input) {
   base::Value::BlobStorage output;
   while (input > static_cast<uint256_t>(0)) {
@@ -49,27 +114,10 @@ base::Value::BlobStorage RLPUint256ToBlob(uint256_t input) {
 }
 
 std::string RLPEncode(base::Value val) {
-  if (val.is_int()) {
-    int i = val.GetInt();
-    return RLPEncode(base::Value(RLPUint256ToBlob((uint256_t)i)));
-  } else if (val.is_blob()) {
-    base::Value::BlobStorage blob = val.GetBlob();
-    std::string s(blob.begin(), blob.end());
-    if (blob.size() == 1 && static_cast<uint8_t>(blob[0]) < 0x80) {
-      return s;
-    }
-    return RLPEncodeLength(blob.size(), 0x80) + s;
-  } else if (val.is_string()) {
-    std::string s = val.GetString();
-    return RLPEncode(base::Value(base::Value::BlobStorage(s.begin(), s.end())));
-  } else if (val.is_list()) {
-    std::string output;
-    for (auto& item : val.GetList()) {
-      output += RLPEncode(std::move(item));
-    }
-    return RLPEncodeLength(output.length(), 0xc0) + output;
-  }
-  return "";
+  std::vector<uint8_t> output;
+  RLPWriter writer(&output);
+  RLPWriteValue(val, &writer);
+  return std::string(output.begin(), output.end());
 }
 
 }  // namespace brave_wallet
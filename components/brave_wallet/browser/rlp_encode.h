@@ -7,17 +7,47 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_ENCODE_H_
 
 #include <string>
+#include <vector>
 
+#include "base/containers/span.h"
+#include "base/memory/raw_ptr.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 
 namespace brave_wallet {
 
+// Writes Recursive Length Prefix (RLP) encoded items straight into |output|
+// without building a base::Value tree first. Items are appended after the
+// existing contents of |output|, so callers can reserve capacity and write a
+// prefix (e.g. a typed transaction envelope byte) up front.
+class RLPWriter {
+ public:
+  explicit RLPWriter(std::vector<uint8_t>* output);
+  ~RLPWriter();
+
+  RLPWriter(const RLPWriter&) = delete;
+  RLPWriter& operator=(const RLPWriter&) = delete;
+
+  void AppendBytes(base::span<const uint8_t> bytes);
+  // Big-endian without leading zeros, zero is the empty string.
+  void AppendUint256(uint256_t value);
+
+  // Items appended between BeginList() and the matching EndList() become the
+  // list's elements. Lists can be nested.
+  void BeginList();
+  void EndList();
+
+ private:
+  const raw_ptr<std::vector<uint8_t>> output_;
+  // Offsets of the payloads of the lists that are still open.
+  std::vector<size_t> open_lists_;
+};
+
 // Converts a uint256_t value into a blob value type
 base::Value::BlobStorage RLPUint256ToBlob(uint256_t input);
 
 // Recursive Length Prefix (RLP) encoding of base::Values consisting of string,
-// blob, or int data
+// blob, or int data. Prefer RLPWriter in new code.
 std::string RLPEncode(base::Value val);
 
 }  // namespace brave_wallet
@@ -6,13 +6,19 @@
 #include <ctype.h>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_wallet/browser/rlp_encode.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace {
 
+base::span<const uint8_t> StringBytes(base::StringPiece s) {
+  return base::as_bytes(base::make_span(s));
+}
+
 base::Value RLPTestStringToValue(const std::string& s, std::string* remaining) {
   const char* start = s.c_str();
   const char* p = start;
@@ -390,4 +396,56 @@ TEST(RLPEncodeTest, DictionaryValueNotSupported) {
   ASSERT_TRUE(brave_wallet::RLPEncode(base::Value(std::move(d))).empty());
 }
 
+TEST(RLPEncodeTest, WriterMatchesValueEncoding) {
+  std::vector<uint8_t> output;
+  RLPWriter writer(&output);
+  writer.BeginList();
+  writer.AppendBytes(StringBytes("cat"));
+  writer.BeginList();
+  writer.AppendBytes(StringBytes("puppy"));
+  writer.AppendBytes(StringBytes("cow"));
+  writer.EndList();
+  writer.AppendBytes(StringBytes("horse"));
+  writer.BeginList();
+  writer.BeginList();
+  writer.EndList();
+  writer.EndList();
+  writer.AppendBytes(StringBytes("pig"));
+  writer.BeginList();
+  writer.AppendBytes({});
+  writer.EndList();
+  writer.AppendBytes(StringBytes("sheep"));
+  writer.EndList();
+  EXPECT_EQ(ToHex(output),
+            "0xe383636174ca85707570707983636f7785686f727365c1c083706967c1808573"
+            "68656570");
+}
+
+TEST(RLPEncodeTest, WriterLongItems) {
+  // Long strings and lists need multi-byte length headers.
+  const std::vector<uint8_t> bytes(1024, 0xaa);
+  std::vector<uint8_t> output = {0x02};
+  RLPWriter writer(&output);
+  writer.BeginList();
+  writer.AppendBytes(bytes);
+  writer.AppendUint256(0);
+  writer.AppendUint256(0x7f);
+  writer.AppendUint256(0x80);
+  writer.AppendUint256(0x0400);
+  writer.EndList();
+
+  base::Value::List list;
+  list.Append(base::Value(bytes));
+  list.Append(RLPUint256ToBlob(0));
+  list.Append(RLPUint256ToBlob(0x7f));
+  list.Append(RLPUint256ToBlob(0x80));
+  list.Append(RLPUint256ToBlob(0x0400));
+  const std::string expected = RLPEncode(base::Value(std::move(list)));
+
+  ASSERT_EQ(output.size(), expected.size() + 1);
+  EXPECT_EQ(0x02, output[0]);
+  EXPECT_EQ(ToHex(expected), ToHex(base::make_span(output).subspan(1)));
+  EXPECT_EQ(0xf9, output[1]);
+}
+
 }  // namespace brave_wallet
@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 #include "brave/components/de_amp/browser/de_amp_throttle.h"
@@ -57,7 +58,15 @@ DeAmpURLLoader::DeAmpURLLoader(
           response_url,
           std::move(destination_url_loader_client),
           task_runner),
-      de_amp_throttle_(throttle) {}
+      de_amp_throttle_(throttle) {
+  // |tag_scanner_| is owned by |this|.
+  tag_scanner_.AddTagHandler(
+      "html", base::BindRepeating(&DeAmpURLLoader::OnHtmlTag,
+                                  base::Unretained(this)));
+  tag_scanner_.AddTagHandler(
+      "link", base::BindRepeating(&DeAmpURLLoader::OnLinkTag,
+                                  base::Unretained(this)));
+}
 
 DeAmpURLLoader::~DeAmpURLLoader() = default;
 
@@ -68,6 +77,8 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
     ForwardBodyToClient();
     return;
   }
+  // The new chunk is run through |tag_scanner_| as it is read, so nothing
+  // before it gets scanned again.
   if (!CheckBufferedBody(kMaxBytesToCheck - buffered_body_.size())) {
     return;
   }
@@ -76,53 +87,64 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
     Abort();
     return;
   }
-  // If we were not redirected and we didn't find AMP, or
-  // if we did find AMP previously and we've already read more bytes than
-  // max, complete the load.
-  if (!found_amp_ || read_bytes_ >= kMaxBytesToCheck) {
-    found_amp_ = false;  // reset
+  // Keep reading only while we are on an AMP page waiting for its canonical
+  // link, or the <html> tag got split across chunks. Otherwise, or if we've
+  // already read more bytes than max, complete the load.
+  const bool keep_sniffing =
+      is_amp_.value_or(false) || (!is_amp_ && tag_scanner_.in_tag());
+  if (!keep_sniffing || read_bytes_ >= kMaxBytesToCheck) {
     CompleteLoading(std::move(buffered_body_));
     return;
   }
   body_consumer_watcher_.ArmOrNotify();
 }
 
+void DeAmpURLLoader::OnHtmlTag(base::StringPiece tag) {
+  // Only the first <html> tag counts.
+  if (!is_amp_) {
+    is_amp_ = IsAmpHtmlTag(tag);
+  }
+}
+
+void DeAmpURLLoader::OnLinkTag(base::StringPiece tag) {
+  // Only the first canonical link counts.
+  if (!canonical_link_ && IsCanonicalLinkTag(tag)) {
+    canonical_link_ = GetCanonicalUrlFromLinkTag(tag);
+  }
+}
+
 bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
   if (!de_amp_throttle_) {
     return false;
   }
 
-  // If we are not already on an AMP page, check if this chunk has the AMP HTML
-  if (!found_amp_ && !CheckIfAmpPage(buffered_body_)) {
+  // Wait until we know we are on an AMP page and have seen its canonical link
+  if (!is_amp_.value_or(false) || !canonical_link_) {
     return false;
   }
 
-  found_amp_ = true;  // If we get to this point, we know we have an AMP page
+  // At this point we'll either redirect, or we should stop trying
+  is_amp_ = false;
 
-  auto canonical_link = FindCanonicalAmpUrl(buffered_body_);
-  if (!canonical_link.has_value()) {
-    VLOG(2) << __func__ << canonical_link.error();
+  if (!canonical_link_->has_value()) {
+    VLOG(2) << __func__ << canonical_link_->error();
     return false;
   }
 
-  bool redirected = false;
-  const GURL canonical_url(canonical_link.value());
+  const GURL canonical_url(canonical_link_->value());
   // Validate the found canonical AMP URL
-  if (VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
-    // Attempt to go to the canonical URL
-    VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
-    if (de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
-      redirected = true;
-    } else {
-      VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
-    }
-  } else {
+  if (!VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
     VLOG(2) << __func__ << " canonical link verification failed "
             << canonical_url;
+    return false;
+  }
+  // Attempt to go to the canonical URL
+  VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
+  if (!de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
+    VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
+    return false;
   }
-  // At this point we've either redirected, or we should stop trying
-  found_amp_ = false;
-  return redirected;
+  return true;
 }
 
 void DeAmpURLLoader::OnBodyWritable(MojoResult r) {
@@ -11,11 +11,14 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/types/expected.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace de_amp {
@@ -44,11 +47,16 @@ class DeAmpURLLoader : public body_sniffer::BodySnifferURLLoader {
                  scoped_refptr<base::SequencedTaskRunner> task_runner);
   void OnBodyReadable(MojoResult) override;
   void OnBodyWritable(MojoResult) override;
+  void OnHtmlTag(base::StringPiece tag);
+  void OnLinkTag(base::StringPiece tag);
   bool MaybeRedirectToCanonicalLink();
   void ForwardBodyToClient();
 
   base::WeakPtr<DeAmpThrottle> de_amp_throttle_;
-  bool found_amp_ = false;
+  // Set once the <html> tag has been seen.
+  absl::optional<bool> is_amp_;
+  // Set once the first canonical <link> tag has been seen.
+  absl::optional<base::expected<std::string, std::string>> canonical_link_;
 };
 
 }  // namespace de_amp
@@ -39,6 +39,30 @@ RE2::Options InitRegexOptions() {
   return opt;
 }
 
+const re2::RE2& GetHtmlTagRegex() {
+  static const base::NoDestructor<re2::RE2> regex(kGetHtmlTagPattern,
+                                                  InitRegexOptions());
+  return *regex;
+}
+
+const re2::RE2& DetectAmpRegex() {
+  static const base::NoDestructor<re2::RE2> regex(kDetectAmpPattern,
+                                                  InitRegexOptions());
+  return *regex;
+}
+
+const re2::RE2& FindCanonicalLinkTagRegex() {
+  static const base::NoDestructor<re2::RE2> regex(kFindCanonicalLinkTagPattern,
+                                                  InitRegexOptions());
+  return *regex;
+}
+
+const re2::RE2& FindCanonicalHrefInTagRegex() {
+  static const base::NoDestructor<re2::RE2> regex(
+      kFindCanonicalHrefInTagPattern, InitRegexOptions());
+  return *regex;
+}
+
 }  // namespace
 
 bool IsDeAmpEnabled(PrefService* prefs) {
@@ -55,44 +79,41 @@ bool VerifyCanonicalAmpUrl(const GURL& canonical_link,
 }
 
 bool CheckIfAmpPage(const std::string& body) {
-  auto opt = InitRegexOptions();
   // The order of running these regexes is important:
   // we first get the relevant HTML tag and then find the info.
-  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(kGetHtmlTagPattern,
-                                                             opt);
-  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(kDetectAmpPattern,
-                                                            opt);
-
   std::string html_tag;
-  if (!RE2::PartialMatch(body, *kGetHtmlTagRegex, &html_tag)) {
+  if (!RE2::PartialMatch(body, GetHtmlTagRegex(), &html_tag)) {
     // Early exit if we can't find HTML tag - malformed document (or error)
     return false;
   }
-  if (!RE2::PartialMatch(html_tag, *kDetectAmpRegex)) {
-    // Not AMP
-    return false;
-  }
-  return true;
+  return IsAmpHtmlTag(html_tag);
 }
 
 base::expected<std::string, std::string> FindCanonicalAmpUrl(
     const std::string& body) {
-  auto opt = InitRegexOptions();
   // The order of running these regexes is important
-  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
-      kFindCanonicalLinkTagPattern, opt);
-  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
-      kFindCanonicalHrefInTagPattern, opt);
-
   std::string link_tag;
-  if (!RE2::PartialMatch(body, *kFindCanonicalLinkTagRegex, &link_tag)) {
+  if (!RE2::PartialMatch(body, FindCanonicalLinkTagRegex(), &link_tag)) {
     // Can't find link tag, exit
     return base::unexpected("Couldn't find link tag");
   }
+  return GetCanonicalUrlFromLinkTag(link_tag);
+}
+
+bool IsAmpHtmlTag(base::StringPiece html_tag) {
+  return RE2::PartialMatch(html_tag, DetectAmpRegex());
+}
+
+bool IsCanonicalLinkTag(base::StringPiece link_tag) {
+  return RE2::PartialMatch(link_tag, FindCanonicalLinkTagRegex());
+}
+
+base::expected<std::string, std::string> GetCanonicalUrlFromLinkTag(
+    base::StringPiece link_tag) {
   std::string canonical_url;
   // Find href in canonical link tag
   // Check there is only 1 href captured, else fail
-  if (!RE2::PartialMatch(link_tag, *kFindCanonicalHrefInTagRegex,
+  if (!RE2::PartialMatch(link_tag, FindCanonicalHrefInTagRegex(),
                          &canonical_url)) {
     // Didn't find canonical link, potentially try again
     return base::unexpected("Couldn't find canonical URL in link tag");
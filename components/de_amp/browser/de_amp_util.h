@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "base/strings/string_piece.h"
 #include "base/types/expected.h"
 #include "components/prefs/pref_service.h"
 #include "url/gurl.h"
@@ -26,6 +27,19 @@ base::expected<std::string, std::string> FindCanonicalAmpUrl(
 
 // Validation check for canonical URL
 bool VerifyCanonicalAmpUrl(const GURL& canonical_url, const GURL& original_url);
+
+// The following run on a single start tag found by
+// body_sniffer::HtmlTagScanner instead of on the whole body.
+
+// Check if an <html> start tag marks the page as AMP
+bool IsAmpHtmlTag(base::StringPiece html_tag);
+
+// Check if a <link> start tag is the canonical link
+bool IsCanonicalLinkTag(base::StringPiece link_tag);
+
+// Get the href of a canonical link tag or return error
+base::expected<std::string, std::string> GetCanonicalUrlFromLinkTag(
+    base::StringPiece link_tag);
 }  // namespace de_amp
 
 #endif  // BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_UTIL_H_
@@ -4,11 +4,54 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "brave/components/de_amp/browser/de_amp_util.h"
+
+#include <string>
+
+#include "base/test/bind.h"
+#include "brave/components/body_sniffer/html_tag_scanner.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace de_amp {
 
 /** Test helpers */
+// Mirrors what DeAmpURLLoader does with the tags found while streaming |body|
+// in |chunk_size| pieces.
+void CheckStreamingResult(const std::string& expected_link,
+                          const std::string& body,
+                          const bool expected_detect_amp,
+                          const bool expected_find_canonical,
+                          size_t chunk_size) {
+  SCOPED_TRACE(chunk_size);
+  absl::optional<bool> is_amp;
+  absl::optional<base::expected<std::string, std::string>> canonical_link;
+  body_sniffer::HtmlTagScanner scanner;
+  scanner.AddTagHandler("html",
+                        base::BindLambdaForTesting([&](base::StringPiece tag) {
+                          if (!is_amp) {
+                            is_amp = IsAmpHtmlTag(tag);
+                          }
+                        }));
+  scanner.AddTagHandler("link",
+                        base::BindLambdaForTesting([&](base::StringPiece tag) {
+                          if (!canonical_link && IsCanonicalLinkTag(tag)) {
+                            canonical_link = GetCanonicalUrlFromLinkTag(tag);
+                          }
+                        }));
+  for (size_t offset = 0; offset < body.size(); offset += chunk_size) {
+    scanner.Feed(base::StringPiece(body).substr(offset, chunk_size));
+  }
+
+  EXPECT_EQ(expected_detect_amp, is_amp.value_or(false));
+  if (expected_detect_amp) {
+    EXPECT_EQ(expected_find_canonical,
+              canonical_link.has_value() && canonical_link->has_value());
+    if (expected_find_canonical) {
+      EXPECT_EQ(expected_link, canonical_link->value());
+    }
+  }
+}
+
 void CheckFindCanonicalLinkResult(const std::string& expected_link,
                                   const std::string& body,
                                   const bool expected_detect_amp,
@@ -23,6 +66,11 @@ void CheckFindCanonicalLinkResult(const std::string& expected_link,
       EXPECT_EQ(expected_link, canonical_link.value());
     }
   }
+  // The streaming path must agree however the body is split.
+  for (size_t chunk_size : {size_t{1}, size_t{5}, body.size()}) {
+    CheckStreamingResult(expected_link, body, expected_detect_amp,
+                         expected_find_canonical, chunk_size);
+  }
 }
 void CheckCheckCanonicalLinkResult(const std::string& canonical_link,
                                    const std::string& original,
@@ -10,7 +10,6 @@
 
 #include "base/base_paths.h"
 #include "base/command_line.h"
-#include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
@@ -51,10 +50,11 @@ void DebounceComponentInstaller::OnDATFileDataReady(
     LOG(WARNING) << parsed_rules.error();
     return;
   }
+  // Drop the index first, it points into |rules_|.
+  rules_index_.clear();
   rules_.clear();
-  host_cache_.clear();
   rules_ = std::move(parsed_rules.value().first);
-  host_cache_ = parsed_rules.value().second;
+  rules_index_ = std::move(parsed_rules.value().second);
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/base64url.h"
+#include "base/containers/flat_set.h"
 #include "base/json/json_reader.h"
 #include "base/strings/escape.h"
 #include "base/strings/stringprintf.h"
@@ -129,7 +130,7 @@ bool DebounceRule::IsSameETLDForDebounce(const GURL& url1, const GURL& url2) {
 
 // static
 base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                         base::flat_set<std::string>>,
+                         DebounceRuleIndex>,
                std::string>
 DebounceRule::ParseRules(const std::string& contents) {
   if (contents.empty()) {
@@ -141,23 +142,56 @@ DebounceRule::ParseRules(const std::string& contents) {
   }
   std::vector<std::string> hosts;
   std::vector<std::unique_ptr<DebounceRule>> rules;
+  // eTLD+1s the include patterns of each rule are restricted to. Rules with
+  // a pattern we can't pin to a single eTLD+1 may apply anywhere.
+  std::vector<base::flat_set<std::string>> rule_hosts;
+  std::vector<bool> rule_matches_any_host;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
+    std::vector<std::string> etldp1s;
+    bool matches_any_host = false;
     for (const URLPattern& pattern : rule->include_pattern_set()) {
-      if (!pattern.host().empty()) {
-        const std::string etldp1 =
-            DebounceRule::GetETLDForDebounce(pattern.host());
-        if (!etldp1.empty())
-          hosts.push_back(std::move(etldp1));
+      const std::string etldp1 =
+          pattern.host().empty()
+              ? std::string()
+              : DebounceRule::GetETLDForDebounce(pattern.host());
+      if (etldp1.empty()) {
+        matches_any_host = true;
+        continue;
       }
+      hosts.push_back(etldp1);
+      etldp1s.push_back(etldp1);
     }
+    rule_hosts.emplace_back(std::move(etldp1s));
+    rule_matches_any_host.push_back(matches_any_host);
     rules.push_back(std::move(rule));
   }
+
+  // Only URLs on these hosts get debounced at all, so they are the only keys.
+  const base::flat_set<std::string> host_set(std::move(hosts));
+  std::vector<DebounceRuleIndex::value_type> entries;
+  entries.reserve(host_set.size());
+  for (const std::string& host : host_set) {
+    entries.emplace_back(host, std::vector<const DebounceRule*>());
+  }
+  DebounceRuleIndex index(base::sorted_unique, std::move(entries));
+  for (size_t i = 0; i < rules.size(); ++i) {
+    if (rule_matches_any_host[i]) {
+      for (auto& entry : index) {
+        entry.second.push_back(rules[i].get());
+      }
+      continue;
+    }
+    for (const std::string& host : rule_hosts[i]) {
+      index.find(host)->second.push_back(rules[i].get());
+    }
+  }
+
   return std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                   base::flat_set<std::string>>(std::move(rules), hosts);
+                   DebounceRuleIndex>(std::move(rules), std::move(index));
 }
 
 bool DebounceRule::CheckPrefForRule(const PrefService* prefs) const {
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/json/json_value_converter.h"
 #include "base/strings/escape.h"
@@ -36,6 +37,13 @@ enum DebouncePrependScheme {
   kDebounceSchemePrependHttps
 };
 
+class DebounceRule;
+
+// Maps the eTLD+1 of every host debounce rules are written for to the rules
+// that can apply to URLs on it, in the order they appear in debounce.json.
+using DebounceRuleIndex =
+    base::flat_map<std::string, std::vector<const DebounceRule*>>;
+
 class DebounceRule {
  public:
   DebounceRule();
@@ -49,8 +57,9 @@ class DebounceRule {
                                   DebounceAction* field);
   static bool ParsePrependScheme(base::StringPiece value,
                                  DebouncePrependScheme* field);
+  // The index points into the returned rules.
   static base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                                  base::flat_set<std::string>>,
+                                  DebounceRuleIndex>,
                         std::string>
   ParseRules(const std::string& contents);
   static const std::string GetETLDForDebounce(const std::string& host);
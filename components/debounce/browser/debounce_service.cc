@@ -5,12 +5,8 @@
 
 #include "brave/components/debounce/browser/debounce_service.h"
 
-#include <memory>
 #include <string>
-#include <vector>
 
-#include "base/containers/contains.h"
-#include "base/containers/flat_set.h"
 #include "base/logging.h"
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 #include "brave/components/debounce/common/pref_names.h"
@@ -29,19 +25,16 @@ DebounceService::~DebounceService() = default;
 
 bool DebounceService::Debounce(const GURL& original_url,
                                GURL* final_url) const {
-  // Check host cache to see if this URL needs to have any debounce rules
-  // applied.
-  const base::flat_set<std::string>& host_cache =
-      component_installer_->host_cache();
+  // Only the rules written for this URL's eTLD+1 (and those that may apply
+  // to any host) can match, if it has none there is nothing to debounce.
+  const DebounceRuleIndex& rules_index = component_installer_->rules_index();
   const std::string etldp1 =
       DebounceRule::GetETLDForDebounce(original_url.host());
-  if (!base::Contains(host_cache, etldp1))
+  const auto it = rules_index.find(etldp1);
+  if (it == rules_index.end())
     return false;
 
-  const std::vector<std::unique_ptr<DebounceRule>>& rules =
-      component_installer_->rules();
-
-  for (const std::unique_ptr<DebounceRule>& rule : rules) {
+  for (const DebounceRule* rule : it->second) {
     if (rule->Apply(original_url, final_url, prefs_)) {
       if (original_url != *final_url) {
         return true;
@@ -445,4 +445,82 @@ TEST(DebounceRuleUnitTest, CatchMultiplePathsForSameInclude) {
   }
 }
 
+TEST(DebounceRuleUnitTest, RulesIndex) {
+  const std::string contents = R"json(
+
+      [{
+          "include": [
+              "*://*.tracker.com/*",
+              "*://click.other.co.uk/*"
+          ],
+          "action": "redirect",
+          "param": "url"
+      }, {
+          "include": [
+              "*://*/*"
+          ],
+          "exclude": [
+              "*://*.other.co.uk/*"
+          ],
+          "action": "redirect",
+          "param": "dest"
+      }, {
+          "include": [
+              "*://other.co.uk/*"
+          ],
+          "action": "redirect",
+          "param": "to"
+      }]
+
+      )json";
+  auto parsed = DebounceRule::ParseRules(contents);
+  ASSERT_TRUE(parsed.has_value());
+  const auto& rules = parsed.value().first;
+  const DebounceRuleIndex& index = parsed.value().second;
+  ASSERT_EQ(3u, rules.size());
+
+  // Rules only get indexed under the hosts they are written for, rules for
+  // any host are indexed under all of them, and file order is kept.
+  ASSERT_EQ(2u, index.size());
+  EXPECT_EQ((std::vector<const DebounceRule*>{rules[0].get(), rules[1].get()}),
+            index.at("tracker.com"));
+  EXPECT_EQ((std::vector<const DebounceRule*>{rules[0].get(), rules[1].get(),
+                                              rules[2].get()}),
+            index.at("other.co.uk"));
+
+  // Applying the indexed rules gives the same result as applying all of them.
+  TestingPrefServiceSimple prefs;
+  for (const char* url :
+       {"https://a.tracker.com/?url=https://brave.com",
+        "https://a.tracker.com/?dest=https://brave.com",
+        "https://click.other.co.uk/?url=https://brave.com",
+        "https://click.other.co.uk/?dest=https://brave.com",
+        "https://other.co.uk/?to=https://brave.com&dest=https://x.com",
+        "https://unrelated.com/?url=https://brave.com"}) {
+    SCOPED_TRACE(url);
+    const GURL original_url(url);
+    GURL expected_url;
+    for (const auto& rule : rules) {
+      GURL final_url;
+      if (rule->Apply(original_url, &final_url, &prefs)) {
+        expected_url = final_url;
+        break;
+      }
+    }
+    GURL indexed_url;
+    const auto it =
+        index.find(DebounceRule::GetETLDForDebounce(original_url.host()));
+    if (it != index.end()) {
+      for (const DebounceRule* rule : it->second) {
+        GURL final_url;
+        if (rule->Apply(original_url, &final_url, &prefs)) {
+          indexed_url = final_url;
+          break;
+        }
+      }
+    }
+    EXPECT_EQ(expected_url, indexed_url);
+  }
+}
+
 }  // namespace debounce
@@ -0,0 +1,129 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/https_upgrade_exceptions/browser/https_upgrade_exceptions_list.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/check_op.h"
+#include "base/memory/ptr_util.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+
+namespace https_upgrade_exceptions {
+
+namespace {
+
+constexpr base::StringPiece kSubdomainsPrefix = "*.";
+
+}  // namespace
+
+HttpsUpgradeExceptionsList::HostTable::HostTable(
+    std::vector<base::StringPiece> hosts) {
+  std::sort(hosts.begin(), hosts.end());
+  hosts.erase(std::unique(hosts.begin(), hosts.end()), hosts.end());
+
+  size_t total_length = 0;
+  for (const auto& host : hosts) {
+    total_length += host.length();
+  }
+  hosts_.reserve(total_length);
+  offsets_.reserve(hosts.size() + 1);
+  for (const auto& host : hosts) {
+    offsets_.push_back(base::checked_cast<uint32_t>(hosts_.length()));
+    hosts_.append(host.data(), host.length());
+  }
+  offsets_.push_back(base::checked_cast<uint32_t>(hosts_.length()));
+}
+
+HttpsUpgradeExceptionsList::HostTable::~HostTable() = default;
+
+bool HttpsUpgradeExceptionsList::HostTable::Contains(
+    base::StringPiece host) const {
+  size_t begin = 0;
+  size_t end = size();
+  while (begin < end) {
+    const size_t middle = begin + (end - begin) / 2;
+    const int result = GetHost(middle).compare(host);
+    if (result == 0) {
+      return true;
+    }
+    if (result < 0) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return false;
+}
+
+size_t HttpsUpgradeExceptionsList::HostTable::EstimateMemoryUsage() const {
+  return hosts_.capacity() + offsets_.capacity() * sizeof(uint32_t);
+}
+
+base::StringPiece HttpsUpgradeExceptionsList::HostTable::GetHost(
+    size_t index) const {
+  DCHECK_LT(index, size());
+  return base::StringPiece(hosts_).substr(
+      offsets_[index], offsets_[index + 1] - offsets_[index]);
+}
+
+HttpsUpgradeExceptionsList::HttpsUpgradeExceptionsList(
+    std::vector<base::StringPiece> hosts,
+    std::vector<base::StringPiece> domains)
+    : hosts_(std::move(hosts)), domains_(std::move(domains)) {}
+
+HttpsUpgradeExceptionsList::~HttpsUpgradeExceptionsList() = default;
+
+// static
+std::unique_ptr<HttpsUpgradeExceptionsList> HttpsUpgradeExceptionsList::Parse(
+    base::StringPiece contents) {
+  std::vector<base::StringPiece> hosts;
+  std::vector<base::StringPiece> domains;
+  for (const auto& line : base::SplitStringPiece(
+           contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (base::StartsWith(line, kSubdomainsPrefix)) {
+      const base::StringPiece domain = line.substr(kSubdomainsPrefix.size());
+      if (!domain.empty()) {
+        domains.push_back(domain);
+      }
+    } else {
+      hosts.push_back(line);
+    }
+  }
+  // The tables copy the hosts, so |contents| can be released afterwards.
+  return base::WrapUnique(
+      new HttpsUpgradeExceptionsList(std::move(hosts), std::move(domains)));
+}
+
+bool HttpsUpgradeExceptionsList::Contains(base::StringPiece host) const {
+  if (hosts_.Contains(host)) {
+    return true;
+  }
+  // Try the host itself and then each of its parent domains.
+  while (!host.empty()) {
+    if (domains_.Contains(host)) {
+      return true;
+    }
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos) {
+      break;
+    }
+    host.remove_prefix(dot + 1);
+  }
+  return false;
+}
+
+size_t HttpsUpgradeExceptionsList::size() const {
+  return hosts_.size() + domains_.size();
+}
+
+size_t HttpsUpgradeExceptionsList::EstimateMemoryUsage() const {
+  return hosts_.EstimateMemoryUsage() + domains_.EstimateMemoryUsage();
+}
+
+}  // namespace https_upgrade_exceptions
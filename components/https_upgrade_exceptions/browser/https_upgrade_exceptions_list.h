@@ -0,0 +1,74 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_HTTPS_UPGRADE_EXCEPTIONS_BROWSER_HTTPS_UPGRADE_EXCEPTIONS_LIST_H_
+#define BRAVE_COMPONENTS_HTTPS_UPGRADE_EXCEPTIONS_BROWSER_HTTPS_UPGRADE_EXCEPTIONS_LIST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+
+namespace https_upgrade_exceptions {
+
+// Immutable list of hosts that must not be upgraded to HTTPS, parsed from the
+// component's text file with one entry per line. A plain entry matches that
+// exact host; an entry of the form "*.example.com" matches example.com and
+// all of its subdomains.
+class HttpsUpgradeExceptionsList {
+ public:
+  HttpsUpgradeExceptionsList(const HttpsUpgradeExceptionsList&) = delete;
+  HttpsUpgradeExceptionsList& operator=(const HttpsUpgradeExceptionsList&) =
+      delete;
+  ~HttpsUpgradeExceptionsList();
+
+  static std::unique_ptr<HttpsUpgradeExceptionsList> Parse(
+      base::StringPiece contents);
+
+  bool Contains(base::StringPiece host) const;
+
+  size_t size() const;
+  size_t EstimateMemoryUsage() const;
+
+ private:
+  // Sorted, de-duplicated hosts stored back to back in a single buffer, so
+  // that the whole table takes two allocations and a lookup is a binary
+  // search over contiguous memory.
+  class HostTable {
+   public:
+    explicit HostTable(std::vector<base::StringPiece> hosts);
+    HostTable(const HostTable&) = delete;
+    HostTable& operator=(const HostTable&) = delete;
+    ~HostTable();
+
+    bool Contains(base::StringPiece host) const;
+
+    size_t size() const { return offsets_.size() - 1; }
+    size_t EstimateMemoryUsage() const;
+
+   private:
+    base::StringPiece GetHost(size_t index) const;
+
+    std::string hosts_;
+    // |offsets_[i]| is where the i-th host starts in |hosts_|, followed by
+    // the end of the last host.
+    std::vector<uint32_t> offsets_;
+  };
+
+  HttpsUpgradeExceptionsList(std::vector<base::StringPiece> hosts,
+                             std::vector<base::StringPiece> domains);
+
+  HostTable hosts_;
+  // Domains whose subdomains are exceptions too.
+  HostTable domains_;
+};
+
+}  // namespace https_upgrade_exceptions
+
+#endif  // BRAVE_COMPONENTS_HTTPS_UPGRADE_EXCEPTIONS_BROWSER_HTTPS_UPGRADE_EXCEPTIONS_LIST_H_
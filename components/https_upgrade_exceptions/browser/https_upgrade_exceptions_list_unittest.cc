@@ -0,0 +1,68 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/https_upgrade_exceptions/browser/https_upgrade_exceptions_list.h"
+
+#include <string>
+
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace https_upgrade_exceptions {
+
+TEST(HttpsUpgradeExceptionsListTest, ExactHosts) {
+  auto list = HttpsUpgradeExceptionsList::Parse(
+      "example.com\n  www.example.org \n\nexample.com\nb.test\na.test\n");
+  EXPECT_EQ(4u, list->size());
+
+  EXPECT_TRUE(list->Contains("example.com"));
+  EXPECT_TRUE(list->Contains("www.example.org"));
+  EXPECT_TRUE(list->Contains("a.test"));
+  EXPECT_TRUE(list->Contains("b.test"));
+
+  EXPECT_FALSE(list->Contains(""));
+  EXPECT_FALSE(list->Contains("test"));
+  EXPECT_FALSE(list->Contains("example.org"));
+  EXPECT_FALSE(list->Contains("www.example.com"));
+  EXPECT_FALSE(list->Contains("example.co"));
+  EXPECT_FALSE(list->Contains("c.test"));
+}
+
+TEST(HttpsUpgradeExceptionsListTest, Subdomains) {
+  auto list =
+      HttpsUpgradeExceptionsList::Parse("*.example.com\n*.\nexample.org\n");
+  EXPECT_EQ(2u, list->size());
+
+  EXPECT_TRUE(list->Contains("example.com"));
+  EXPECT_TRUE(list->Contains("www.example.com"));
+  EXPECT_TRUE(list->Contains("a.b.example.com"));
+  EXPECT_TRUE(list->Contains("example.org"));
+
+  EXPECT_FALSE(list->Contains("badexample.com"));
+  EXPECT_FALSE(list->Contains("example.com.evil.test"));
+  EXPECT_FALSE(list->Contains("com"));
+  EXPECT_FALSE(list->Contains("www.example.org"));
+}
+
+TEST(HttpsUpgradeExceptionsListTest, ManyHosts) {
+  std::string contents;
+  for (int i = 0; i < 10000; ++i) {
+    base::StrAppend(&contents, {"host", base::NumberToString(i), ".test\n"});
+  }
+  auto list = HttpsUpgradeExceptionsList::Parse(contents);
+  EXPECT_EQ(10000u, list->size());
+  // One byte per character plus an offset per host, with no per-entry
+  // allocations.
+  EXPECT_LT(list->EstimateMemoryUsage(), contents.size() + 10001 * 4);
+
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_TRUE(list->Contains(
+        base::StrCat({"host", base::NumberToString(i), ".test"})));
+  }
+  EXPECT_FALSE(list->Contains("host10000.test"));
+}
+
+}  // namespace https_upgrade_exceptions
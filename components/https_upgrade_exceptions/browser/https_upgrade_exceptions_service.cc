@@ -6,14 +6,11 @@
 #include "brave/components/https_upgrade_exceptions/browser/https_upgrade_exceptions_service.h"
 
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
-#include <vector>
 
-#include "base/containers/contains.h"
 #include "base/files/file_path.h"
-#include "base/strings/string_split.h"
+#include "base/logging.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
@@ -26,6 +23,21 @@ namespace https_upgrade_exceptions {
 using brave_component_updater::LocalDataFilesObserver;
 using brave_component_updater::LocalDataFilesService;
 
+namespace {
+
+std::unique_ptr<HttpsUpgradeExceptionsList> LoadExceptionsFromFile(
+    const base::FilePath& txt_file_path) {
+  const std::string contents =
+      brave_component_updater::GetDATFileAsString(txt_file_path);
+  if (contents.empty()) {
+    // We don't have the file yet.
+    return nullptr;
+  }
+  return HttpsUpgradeExceptionsList::Parse(contents);
+}
+
+}  // namespace
+
 HttpsUpgradeExceptionsService::HttpsUpgradeExceptionsService(
     LocalDataFilesService* local_data_files_service)
     : LocalDataFilesObserver(local_data_files_service) {}
@@ -37,25 +49,22 @@ void HttpsUpgradeExceptionsService::LoadHTTPSUpgradeExceptions(
           .AppendASCII(HTTPS_UPGRADE_EXCEPTIONS_TXT_FILE);
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     txt_file_path),
-      base::BindOnce(&HttpsUpgradeExceptionsService::OnDATFileDataReady,
+      base::BindOnce(&LoadExceptionsFromFile, txt_file_path),
+      base::BindOnce(&HttpsUpgradeExceptionsService::OnExceptionsLoaded,
                      weak_factory_.GetWeakPtr()));
 }
 
-void HttpsUpgradeExceptionsService::OnDATFileDataReady(
-    const std::string& contents) {
-  if (contents.empty()) {
-    // We don't have the file yet.
+void HttpsUpgradeExceptionsService::OnExceptionsLoaded(
+    std::unique_ptr<HttpsUpgradeExceptionsList> exceptions) {
+  if (!exceptions) {
     return;
   }
-  std::vector<std::string> lines = base::SplitString(
-      contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-  for (const auto& line : lines) {
-    exceptional_domains_.insert(std::move(line));
-  }
+  VLOG(1) << "Loaded " << exceptions->size()
+          << " HTTPS upgrade exceptions using "
+          << exceptions->EstimateMemoryUsage() << " bytes";
+  // Lookups see either the old list or the new one, never a partial list.
+  exceptions_ = std::move(exceptions);
   is_ready_ = true;
-  return;
 }
 
 bool HttpsUpgradeExceptionsService::CanUpgradeToHTTPS(const GURL& url) {
@@ -65,7 +74,7 @@ bool HttpsUpgradeExceptionsService::CanUpgradeToHTTPS(const GURL& url) {
     return false;
   }
   // Allow upgrade only if the domain is not on the exceptions list.
-  return !base::Contains(exceptional_domains_, url.host());
+  return !exceptions_ || !exceptions_->Contains(url.host_piece());
 }
 
 // implementation of LocalDataFilesObserver
@@ -76,9 +85,7 @@ void HttpsUpgradeExceptionsService::OnComponentReady(
   LoadHTTPSUpgradeExceptions(install_dir);
 }
 
-HttpsUpgradeExceptionsService::~HttpsUpgradeExceptionsService() {
-  exceptional_domains_.clear();
-}
+HttpsUpgradeExceptionsService::~HttpsUpgradeExceptionsService() = default;
 
 std::unique_ptr<HttpsUpgradeExceptionsService>
 HttpsUpgradeExceptionsServiceFactory(
@@ -7,13 +7,13 @@
 #define BRAVE_COMPONENTS_HTTPS_UPGRADE_EXCEPTIONS_BROWSER_HTTPS_UPGRADE_EXCEPTIONS_SERVICE_H_
 
 #include <memory>
-#include <set>
 #include <string>
 
 #include "base/files/file_path.h"
 #include "base/strings/string_piece.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
+#include "brave/components/https_upgrade_exceptions/browser/https_upgrade_exceptions_list.h"
 
 namespace https_upgrade_exceptions {
 
@@ -31,11 +31,15 @@ class HttpsUpgradeExceptionsService
   bool CanUpgradeToHTTPS(const GURL& url);
   ~HttpsUpgradeExceptionsService() override;
   void SetIsReadyForTesting() { is_ready_ = true; }
-  void OnDATFileDataReady(const std::string& contents);
 
  private:
   void LoadHTTPSUpgradeExceptions(const base::FilePath& install_dir);
-  std::set<std::string> exceptional_domains_;
+  void OnExceptionsLoaded(
+      std::unique_ptr<HttpsUpgradeExceptionsList> exceptions);
+
+  // Parsed off the UI thread and replaced as a whole when the component is
+  // updated.
+  std::unique_ptr<HttpsUpgradeExceptionsList> exceptions_;
   bool is_ready_ = false;
   base::WeakPtrFactory<HttpsUpgradeExceptionsService> weak_factory_{this};
 };
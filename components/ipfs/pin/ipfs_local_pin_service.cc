@@ -12,11 +12,9 @@
 
 #include "base/containers/contains.h"
 #include "base/functional/callback.h"
-#include "base/strings/strcat.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "brave/components/ipfs/pref_names.h"
-#include "components/prefs/scoped_user_pref_update.h"
 
 namespace ipfs {
 
@@ -24,23 +22,6 @@ bool PinData::operator==(const PinData& d) const {
   return this->cid == d.cid && this->pinning_mode == d.pinning_mode;
 }
 
-namespace {
-const char kRecursiveMode[] = "recursive";
-const char kDirectMode[] = "direct";
-
-std::string GetPrefNameFromPinningMode(PinningMode mode) {
-  switch (mode) {
-    case DIRECT:
-      return kDirectMode;
-    case RECURSIVE:
-      return kRecursiveMode;
-  }
-  NOTREACHED();
-  return kRecursiveMode;
-}
-
-}  // namespace
-
 // Splits ipfs:// url to a list of PinData items
 absl::optional<std::vector<PinData>> IpfsLocalPinService::ExtractPinData(
     const std::string& ipfs_url) {
@@ -85,12 +66,12 @@ IpfsLocalPinService::ExtractMergedPinData(
   return result;
 }
 
-AddLocalPinJob::AddLocalPinJob(PrefService* prefs_service,
+AddLocalPinJob::AddLocalPinJob(IpfsLocalPinStore* pin_store,
                                IpfsService* ipfs_service,
                                const std::string& key,
                                const std::vector<PinData>& pins_data,
                                AddPinCallback callback)
-    : prefs_service_(prefs_service),
+    : pin_store_(pin_store),
       ipfs_service_(ipfs_service),
       key_(key),
       pins_data_(pins_data),
@@ -146,61 +127,24 @@ void AddLocalPinJob::OnAddPinResult(
     return;
   }
 
-  {
-    ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
-    base::Value::Dict& update_dict = update.Get();
-
-    for (const auto& add_pin_result : result) {
-      auto* mode_dict = update_dict.EnsureDict(GetPrefNameFromPinningMode(
-          add_pin_result->recursive ? PinningMode::RECURSIVE
-                                    : PinningMode::DIRECT));
-      for (const auto& cid : add_pin_result->pins) {
-        base::Value::List* list = mode_dict->EnsureList(cid);
-        list->EraseValue(base::Value(key_));
-        list->Append(base::Value(key_));
-      }
-    }
+  for (const auto& add_pin_result : result) {
+    pin_store_->AddPins(key_,
+                        add_pin_result->recursive ? PinningMode::RECURSIVE
+                                                  : PinningMode::DIRECT,
+                        add_pin_result->pins);
   }
   std::move(callback_).Run(true);
 }
 
-RemoveLocalPinJob::RemoveLocalPinJob(PrefService* prefs_service,
+RemoveLocalPinJob::RemoveLocalPinJob(IpfsLocalPinStore* pin_store,
                                      const std::string& key,
                                      RemovePinCallback callback)
-    : prefs_service_(prefs_service),
-      key_(key),
-      callback_(std::move(callback)) {}
+    : pin_store_(pin_store), key_(key), callback_(std::move(callback)) {}
 
 RemoveLocalPinJob::~RemoveLocalPinJob() = default;
 
 void RemoveLocalPinJob::Start() {
-  {
-    ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
-    base::Value::Dict& pinning_modes_dict = update.Get();
-    // Iterate over pinning modes
-    for (const auto pair : pinning_modes_dict) {
-      auto* cids_dict = pair.second.GetIfDict();
-      if (!cids_dict) {
-        NOTREACHED() << "Corrupted prefs structure.";
-        continue;
-      }
-
-      std::vector<std::string> remove_list;
-      // Iterate over CIDs
-      for (const auto cid : *cids_dict) {
-        base::Value::List* list = cid.second.GetIfList();
-        if (list) {
-          list->EraseValue(base::Value(key_));
-          if (list->empty()) {
-            remove_list.push_back(cid.first);
-          }
-        }
-      }
-      for (const auto& cid : remove_list) {
-        cids_dict->Remove(cid);
-      }
-    }
-  }
+  pin_store_->RemovePins(key_);
   std::move(callback_).Run(true);
 }
 
@@ -243,10 +187,10 @@ void VerifyLocalPinJob::OnGetPinsResult(absl::optional<GetPinsResult> result) {
   std::move(callback_).Run(result->size() == pins_data_.size());
 }
 
-GcJob::GcJob(PrefService* prefs_service,
+GcJob::GcJob(IpfsLocalPinStore* pin_store,
              IpfsService* ipfs_service,
              GcCallback callback)
-    : prefs_service_(prefs_service),
+    : pin_store_(pin_store),
       ipfs_service_(ipfs_service),
       callback_(std::move(callback)) {}
 
@@ -287,19 +231,11 @@ void GcJob::OnGetPinsResult(std::vector<absl::optional<GetPinsResult>> result) {
     return;
   }
 
+  // Unpin whatever the node has pinned that no key owns in either mode.
   std::vector<std::string> cids_to_delete;
-  const base::Value::Dict& pinning_modes_dict =
-      prefs_service_->GetDict(kIPFSPinnedCids);
-  // Check both recursive and direct mode dictionaries. If there is no CID in
-  // both, then unpin.
   for (const auto& it : result) {
     for (const auto& cid : it.value()) {
-      if (!pinning_modes_dict.FindListByDottedPath(
-              base::StrCat({GetPrefNameFromPinningMode(PinningMode::RECURSIVE),
-                            ".", cid.first})) &&
-          !pinning_modes_dict.FindListByDottedPath(
-              base::StrCat({GetPrefNameFromPinningMode(PinningMode::DIRECT),
-                            ".", cid.first}))) {
+      if (!pin_store_->IsPinned(cid.first)) {
         cids_to_delete.push_back(cid.first);
       }
     }
@@ -322,6 +258,7 @@ IpfsLocalPinService::IpfsLocalPinService(PrefService* prefs_service,
                                          IpfsService* ipfs_service)
     : prefs_service_(prefs_service), ipfs_service_(ipfs_service) {
   ipfs_base_pin_service_ = std::make_unique<IpfsBasePinService>(ipfs_service_);
+  pin_store_ = std::make_unique<IpfsLocalPinStore>(prefs_service_);
 }
 
 void IpfsLocalPinService::Reset(base::OnceCallback<void(bool)> callback) {
@@ -390,7 +327,7 @@ void IpfsLocalPinService::AddPins(const std::string& key,
     return;
   }
   ipfs_base_pin_service_->AddJob(std::make_unique<AddLocalPinJob>(
-      prefs_service_, ipfs_service_, key, pins_data.value(),
+      pin_store_.get(), ipfs_service_, key, pins_data.value(),
       base::BindOnce(&IpfsLocalPinService::OnAddJobFinished,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback))));
 }
@@ -398,7 +335,7 @@ void IpfsLocalPinService::AddPins(const std::string& key,
 void IpfsLocalPinService::RemovePins(const std::string& key,
                                      RemovePinCallback callback) {
   ipfs_base_pin_service_->AddJob(std::make_unique<RemoveLocalPinJob>(
-      prefs_service_, key,
+      pin_store_.get(), key,
       base::BindOnce(&IpfsLocalPinService::OnRemovePinsFinished,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback))));
 }
@@ -450,7 +387,7 @@ void IpfsLocalPinService::AddGcTask() {
   }
   gc_task_posted_ = true;
   ipfs_base_pin_service_->AddJob(std::make_unique<GcJob>(
-      prefs_service_, ipfs_service_,
+      pin_store_.get(), ipfs_service_,
       base::BindOnce(&IpfsLocalPinService::OnGcFinishedCallback,
                      weak_ptr_factory_.GetWeakPtr())));
 }
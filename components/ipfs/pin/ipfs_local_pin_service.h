@@ -16,14 +16,13 @@
 #include "base/gtest_prod_util.h"
 #include "brave/components/ipfs/ipfs_service.h"
 #include "brave/components/ipfs/pin/ipfs_base_pin_service.h"
+#include "brave/components/ipfs/pin/ipfs_local_pin_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 using ipfs::IpfsService;
 
 namespace ipfs {
 
-enum PinningMode { DIRECT = 0, RECURSIVE = 1 };
-
 struct PinData {
   std::string cid;
   PinningMode pinning_mode;
@@ -65,7 +64,7 @@ using GcCallback = base::OnceCallback<void(bool)>;
  */
 class AddLocalPinJob : public IpfsBaseJob {
  public:
-  AddLocalPinJob(PrefService* prefs_service,
+  AddLocalPinJob(IpfsLocalPinStore* pin_store,
                  IpfsService* ipfs_service,
                  const std::string& key,
                  const std::vector<PinData>& pins_data,
@@ -80,7 +79,7 @@ class AddLocalPinJob : public IpfsBaseJob {
       absl::optional<AddPinResult> result);
   void OnAddPinResult(std::vector<absl::optional<AddPinResult>> result);
 
-  raw_ptr<PrefService> prefs_service_;
+  raw_ptr<IpfsLocalPinStore> pin_store_;
   raw_ptr<IpfsService> ipfs_service_;
   std::string key_;
   std::vector<PinData> pins_data_;
@@ -94,7 +93,7 @@ class AddLocalPinJob : public IpfsBaseJob {
 // Removes records related to the key and launches GC task.
 class RemoveLocalPinJob : public IpfsBaseJob {
  public:
-  RemoveLocalPinJob(PrefService* prefs_service,
+  RemoveLocalPinJob(IpfsLocalPinStore* pin_store,
                     const std::string& key,
                     RemovePinCallback callback);
   ~RemoveLocalPinJob() override;
@@ -102,7 +101,7 @@ class RemoveLocalPinJob : public IpfsBaseJob {
   void Start() override;
 
  private:
-  raw_ptr<PrefService> prefs_service_;
+  raw_ptr<IpfsLocalPinStore> pin_store_;
   std::string key_;
   RemovePinCallback callback_;
   base::WeakPtrFactory<RemoveLocalPinJob> weak_ptr_factory_{this};
@@ -134,7 +133,7 @@ class VerifyLocalPinJob : public IpfsBaseJob {
 // Unpins cids that don't have kIPFSPinnedCids record
 class GcJob : public IpfsBaseJob {
  public:
-  GcJob(PrefService* prefs_service,
+  GcJob(IpfsLocalPinStore* pin_store,
         IpfsService* ipfs_service,
         GcCallback callback);
   ~GcJob() override;
@@ -148,7 +147,7 @@ class GcJob : public IpfsBaseJob {
   void OnGetPinsResult(std::vector<absl::optional<GetPinsResult>> result);
   void OnPinsRemovedResult(absl::optional<RemovePinResult> result);
 
-  raw_ptr<PrefService> prefs_service_;
+  raw_ptr<IpfsLocalPinStore> pin_store_;
   raw_ptr<IpfsService> ipfs_service_;
   GcCallback callback_;
   bool gc_job_failed_ = false;
@@ -200,6 +199,9 @@ class IpfsLocalPinService : public KeyedService {
   bool HasJobs();
 
   bool gc_task_posted_ = false;
+  // Declared before |ipfs_base_pin_service_| so that it outlives the queued
+  // jobs, which point to it.
+  std::unique_ptr<IpfsLocalPinStore> pin_store_;
   std::unique_ptr<IpfsBasePinService> ipfs_base_pin_service_;
   raw_ptr<PrefService> prefs_service_;
   raw_ptr<IpfsService> ipfs_service_;
@@ -419,6 +419,7 @@ TEST_F(IpfsLocalPinServiceTest, VerifyLocalPinJobTest) {
 }
 
 TEST_F(IpfsLocalPinServiceTest, GcJobTest) {
+  IpfsLocalPinStore pin_store(GetPrefs());
   {
     std::string base = R"({"recursive":{
                                   "Qma" : ["a", "b"],
@@ -436,7 +437,7 @@ TEST_F(IpfsLocalPinServiceTest, GcJobTest) {
 
   {
     absl::optional<bool> success;
-    GcJob job(GetPrefs(), GetIpfsService(),
+    GcJob job(&pin_store, GetIpfsService(),
               base::BindLambdaForTesting(
                   [&success](bool result) { success = result; }));
 
@@ -462,7 +463,7 @@ TEST_F(IpfsLocalPinServiceTest, GcJobTest) {
 
   {
     absl::optional<bool> success;
-    GcJob job(GetPrefs(), GetIpfsService(),
+    GcJob job(&pin_store, GetIpfsService(),
               base::BindLambdaForTesting(
                   [&success](bool result) { success = result; }));
 
@@ -502,7 +503,7 @@ TEST_F(IpfsLocalPinServiceTest, GcJobTest) {
 
   {
     absl::optional<bool> success;
-    GcJob job(GetPrefs(), GetIpfsService(),
+    GcJob job(&pin_store, GetIpfsService(),
               base::BindLambdaForTesting(
                   [&success](bool result) { success = result; }));
 
@@ -0,0 +1,154 @@
+// Copyright (c) 2023 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/components/ipfs/pin/ipfs_local_pin_store.h"
+
+#include "base/auto_reset.h"
+#include "base/functional/bind.h"
+#include "base/notreached.h"
+#include "brave/components/ipfs/pref_names.h"
+#include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
+
+namespace ipfs {
+
+namespace {
+const char kRecursiveMode[] = "recursive";
+const char kDirectMode[] = "direct";
+
+constexpr PinningMode kPinningModes[] = {PinningMode::RECURSIVE,
+                                         PinningMode::DIRECT};
+}  // namespace
+
+std::string GetPrefNameFromPinningMode(PinningMode mode) {
+  switch (mode) {
+    case DIRECT:
+      return kDirectMode;
+    case RECURSIVE:
+      return kRecursiveMode;
+  }
+  NOTREACHED();
+  return kRecursiveMode;
+}
+
+IpfsLocalPinStore::IpfsLocalPinStore(PrefService* prefs_service)
+    : prefs_service_(prefs_service) {
+  pref_change_registrar_.Init(prefs_service_);
+  pref_change_registrar_.Add(
+      kIPFSPinnedCids, base::BindRepeating(&IpfsLocalPinStore::OnPrefChanged,
+                                           base::Unretained(this)));
+}
+
+IpfsLocalPinStore::~IpfsLocalPinStore() = default;
+
+void IpfsLocalPinStore::AddPins(const std::string& key,
+                                PinningMode mode,
+                                const std::vector<std::string>& cids) {
+  EnsureLoaded();
+
+  base::AutoReset<bool> updating_pref(&updating_pref_, true);
+  ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
+  auto* mode_dict = update->EnsureDict(GetPrefNameFromPinningMode(mode));
+  auto& pins_of_key = pins_by_key_[key];
+  for (const auto& cid : cids) {
+    // The key is moved to the end of the CID's list if it's already there.
+    base::Value::List* list = mode_dict->EnsureList(cid);
+    list->EraseValue(base::Value(key));
+    list->Append(key);
+
+    PinnedCid pinned_cid(mode, cid);
+    owners_[pinned_cid].insert(key);
+    pins_of_key.insert(std::move(pinned_cid));
+  }
+}
+
+void IpfsLocalPinStore::RemovePins(const std::string& key) {
+  EnsureLoaded();
+
+  auto pins_of_key = pins_by_key_.find(key);
+  if (pins_of_key == pins_by_key_.end()) {
+    return;
+  }
+
+  base::AutoReset<bool> updating_pref(&updating_pref_, true);
+  ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
+  for (const auto& pinned_cid : pins_of_key->second) {
+    const auto& [mode, cid] = pinned_cid;
+    auto* mode_dict = update->FindDict(GetPrefNameFromPinningMode(mode));
+    if (mode_dict) {
+      base::Value::List* list = mode_dict->FindList(cid);
+      if (list) {
+        list->EraseValue(base::Value(key));
+      }
+      if (!list || list->empty()) {
+        mode_dict->Remove(cid);
+      }
+    }
+
+    auto owners = owners_.find(pinned_cid);
+    if (owners != owners_.end()) {
+      owners->second.erase(key);
+      if (owners->second.empty()) {
+        owners_.erase(owners);
+      }
+    }
+  }
+  pins_by_key_.erase(pins_of_key);
+}
+
+bool IpfsLocalPinStore::IsPinned(const std::string& cid) {
+  EnsureLoaded();
+
+  for (auto mode : kPinningModes) {
+    if (owners_.count(PinnedCid(mode, cid))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void IpfsLocalPinStore::EnsureLoaded() {
+  if (loaded_) {
+    return;
+  }
+  loaded_ = true;
+
+  const base::Value::Dict& pinning_modes_dict =
+      prefs_service_->GetDict(kIPFSPinnedCids);
+  for (auto mode : kPinningModes) {
+    const auto* cids_dict =
+        pinning_modes_dict.FindDict(GetPrefNameFromPinningMode(mode));
+    if (!cids_dict) {
+      continue;
+    }
+    for (const auto [cid, keys] : *cids_dict) {
+      const auto* list = keys.GetIfList();
+      if (!list) {
+        continue;
+      }
+      PinnedCid pinned_cid(mode, cid);
+      auto& owners = owners_[pinned_cid];
+      for (const auto& key : *list) {
+        if (!key.is_string()) {
+          continue;
+        }
+        owners.insert(key.GetString());
+        pins_by_key_[key.GetString()].insert(pinned_cid);
+      }
+    }
+  }
+}
+
+void IpfsLocalPinStore::OnPrefChanged() {
+  if (updating_pref_) {
+    return;
+  }
+  // Changed outside of the store, e.g. cleared on reset.
+  loaded_ = false;
+  owners_.clear();
+  pins_by_key_.clear();
+}
+
+}  // namespace ipfs
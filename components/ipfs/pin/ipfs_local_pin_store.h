@@ -0,0 +1,74 @@
+// Copyright (c) 2023 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef BRAVE_COMPONENTS_IPFS_PIN_IPFS_LOCAL_PIN_STORE_H_
+#define BRAVE_COMPONENTS_IPFS_PIN_IPFS_LOCAL_PIN_STORE_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_set.h"
+#include "base/memory/raw_ptr.h"
+#include "components/prefs/pref_change_registrar.h"
+
+class PrefService;
+
+namespace ipfs {
+
+enum PinningMode { DIRECT = 0, RECURSIVE = 1 };
+
+// Returns the kIPFSPinnedCids entry for |mode|, which is also the pin type
+// name used by the IPFS node.
+std::string GetPrefNameFromPinningMode(PinningMode mode);
+
+// Bookkeeping of which keys own which locally pinned CIDs. Persisted in
+// kIPFSPinnedCids (see AddLocalPinJob for the format) and mirrored in memory
+// as a forward index (CID -> keys) and a reverse index (key -> CIDs), so that
+// removing a key only touches that key's CIDs instead of every pinned CID.
+// The indices are built on first use and rebuilt if the pref is changed by
+// anything other than the store.
+class IpfsLocalPinStore {
+ public:
+  explicit IpfsLocalPinStore(PrefService* prefs_service);
+  IpfsLocalPinStore(const IpfsLocalPinStore&) = delete;
+  IpfsLocalPinStore& operator=(const IpfsLocalPinStore&) = delete;
+  ~IpfsLocalPinStore();
+
+  // Records that |key| owns |cids| pinned with |mode|.
+  void AddPins(const std::string& key,
+               PinningMode mode,
+               const std::vector<std::string>& cids);
+
+  // Drops all records of |key|. CIDs that have no owner left are forgotten.
+  void RemovePins(const std::string& key);
+
+  // Returns whether any key owns |cid|, in any pinning mode.
+  bool IsPinned(const std::string& cid);
+
+ private:
+  using PinnedCid = std::pair<PinningMode, std::string>;
+
+  void EnsureLoaded();
+  void OnPrefChanged();
+
+  raw_ptr<PrefService> prefs_service_;
+  PrefChangeRegistrar pref_change_registrar_;
+
+  bool loaded_ = false;
+  // Set while the store writes the pref, so that it doesn't reload its own
+  // changes.
+  bool updating_pref_ = false;
+  // (mode, CID) -> keys owning it.
+  std::map<PinnedCid, base::flat_set<std::string>> owners_;
+  // Key -> (mode, CID) it owns.
+  std::map<std::string, std::set<PinnedCid>> pins_by_key_;
+};
+
+}  // namespace ipfs
+
+#endif  // BRAVE_COMPONENTS_IPFS_PIN_IPFS_LOCAL_PIN_STORE_H_
@@ -0,0 +1,126 @@
+// Copyright (c) 2023 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/components/ipfs/pin/ipfs_local_pin_store.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/json/json_reader.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/components/ipfs/ipfs_service.h"
+#include "brave/components/ipfs/pref_names.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ipfs {
+
+class IpfsLocalPinStoreTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    IpfsService::RegisterProfilePrefs(pref_service_.registry());
+  }
+
+  void SetPinnedCids(const std::string& json) {
+    absl::optional<base::Value> value = base::JSONReader::Read(json);
+    ASSERT_TRUE(value);
+    pref_service_.SetDict(kIPFSPinnedCids, std::move(value->GetDict()));
+  }
+
+  void ExpectPinnedCids(const std::string& json) {
+    absl::optional<base::Value> value = base::JSONReader::Read(json);
+    ASSERT_TRUE(value);
+    EXPECT_EQ(*value, pref_service_.GetDict(kIPFSPinnedCids));
+  }
+
+  TestingPrefServiceSimple pref_service_;
+};
+
+TEST_F(IpfsLocalPinStoreTest, AddAndRemove) {
+  IpfsLocalPinStore store(&pref_service_);
+  store.AddPins("a", PinningMode::RECURSIVE, {"Qm1", "Qm2"});
+  store.AddPins("a", PinningMode::DIRECT, {"Qm3"});
+  store.AddPins("b", PinningMode::RECURSIVE, {"Qm2", "Qm4"});
+  // Re-adding moves the key to the end of the list.
+  store.AddPins("a", PinningMode::RECURSIVE, {"Qm2"});
+  ExpectPinnedCids(R"({
+      "recursive": {"Qm1": ["a"], "Qm2": ["b", "a"], "Qm4": ["b"]},
+      "direct": {"Qm3": ["a"]}
+  })");
+  for (const char* cid : {"Qm1", "Qm2", "Qm3", "Qm4"}) {
+    EXPECT_TRUE(store.IsPinned(cid)) << cid;
+  }
+  EXPECT_FALSE(store.IsPinned("Qm5"));
+
+  store.RemovePins("a");
+  ExpectPinnedCids(R"({
+      "recursive": {"Qm2": ["b"], "Qm4": ["b"]},
+      "direct": {}
+  })");
+  EXPECT_FALSE(store.IsPinned("Qm1"));
+  EXPECT_TRUE(store.IsPinned("Qm2"));
+  EXPECT_FALSE(store.IsPinned("Qm3"));
+
+  // Unknown keys are a no-op.
+  store.RemovePins("c");
+  store.RemovePins("b");
+  ExpectPinnedCids(R"({"recursive": {}, "direct": {}})");
+  EXPECT_FALSE(store.IsPinned("Qm2"));
+}
+
+TEST_F(IpfsLocalPinStoreTest, LoadsAndFollowsPref) {
+  // Dots in CIDs must not be treated as paths.
+  SetPinnedCids(R"({
+      "recursive": {"Qm1": ["a", "b"], "Qm.2": ["b"]},
+      "direct": {"Qm3": ["a"]}
+  })");
+  IpfsLocalPinStore store(&pref_service_);
+  EXPECT_TRUE(store.IsPinned("Qm.2"));
+
+  store.RemovePins("b");
+  ExpectPinnedCids(R"({
+      "recursive": {"Qm1": ["a"]},
+      "direct": {"Qm3": ["a"]}
+  })");
+
+  // Changes made behind the store's back are picked up.
+  pref_service_.ClearPref(kIPFSPinnedCids);
+  EXPECT_FALSE(store.IsPinned("Qm1"));
+  SetPinnedCids(R"({"direct": {"Qm5": ["c"]}})");
+  EXPECT_TRUE(store.IsPinned("Qm5"));
+  store.RemovePins("c");
+  ExpectPinnedCids(R"({"direct": {}})");
+}
+
+TEST_F(IpfsLocalPinStoreTest, ManyCids) {
+  constexpr int kNumCids = 100000;
+  constexpr int kNumKeys = 1000;
+  IpfsLocalPinStore store(&pref_service_);
+  std::vector<std::string> cids;
+  for (int key = 0; key < kNumKeys; ++key) {
+    cids.clear();
+    for (int i = key; i < kNumCids; i += kNumKeys) {
+      cids.push_back("Qm" + base::NumberToString(i));
+    }
+    store.AddPins(base::NumberToString(key), PinningMode::RECURSIVE, cids);
+  }
+  EXPECT_EQ(static_cast<size_t>(kNumCids),
+            pref_service_.GetDict(kIPFSPinnedCids)
+                .FindDict("recursive")
+                ->size());
+
+  store.RemovePins("0");
+  EXPECT_EQ(static_cast<size_t>(kNumCids - kNumCids / kNumKeys),
+            pref_service_.GetDict(kIPFSPinnedCids)
+                .FindDict("recursive")
+                ->size());
+  EXPECT_FALSE(store.IsPinned("Qm0"));
+  EXPECT_FALSE(store.IsPinned("Qm99000"));
+  EXPECT_TRUE(store.IsPinned("Qm1"));
+  EXPECT_TRUE(store.IsPinned("Qm99999"));
+}
+
+}  // namespace ipfs
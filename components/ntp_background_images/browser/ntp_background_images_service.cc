@@ -43,6 +43,8 @@ namespace ntp_background_images {
 namespace {
 
 constexpr int kSIComponentUpdateCheckIntervalMins = 15;
+// Enough for a few full size wallpapers plus sponsored images and logos.
+constexpr size_t kMaxImageCacheSizeInBytes = 16 * 1024 * 1024;
 constexpr char kNTPManifestFile[] = "photo.json";
 constexpr char kNTPSRMappingTableFile[] = "mapping-table.json";
 
@@ -103,6 +105,7 @@ NTPBackgroundImagesService::NTPBackgroundImagesService(
     PrefService* local_pref)
     : component_update_service_(cus),
       local_pref_(local_pref),
+      image_cache_(kMaxImageCacheSizeInBytes),
       weak_factory_(this) {
 }
 
@@ -478,6 +481,7 @@ void NTPBackgroundImagesService::OnGetComponentJsonData(
     const std::string& json_string) {
   bi_images_data_ =
       std::make_unique<NTPBackgroundImagesData>(json_string, bi_installed_dir_);
+  image_cache_.Clear();
 
   for (auto& observer : observer_list_) {
     observer.OnUpdated(bi_images_data_.get());
@@ -524,6 +528,7 @@ void NTPBackgroundImagesService::OnGetSponsoredComponentJsonData(
     si_images_data_ = std::make_unique<NTPSponsoredImagesData>(
         json_string, si_installed_dir_);
   }
+  image_cache_.Clear();
 
   if (is_super_referral && !sr_images_data_->IsValid()) {
     DVLOG(2) << __func__ << ": NTP SR campaign ends.";
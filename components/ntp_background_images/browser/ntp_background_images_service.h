@@ -17,6 +17,7 @@
 #include "base/observer_list.h"
 #include "base/timer/timer.h"
 #include "base/values.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
 #include "components/prefs/pref_change_registrar.h"
 
 namespace component_updater {
@@ -66,6 +67,10 @@ class NTPBackgroundImagesService {
 
   bool test_data_used() const { return test_data_used_; }
 
+  // Image files are served through this cache. It is cleared whenever one of
+  // the components is updated.
+  NTPImageCache* image_cache() { return &image_cache_; }
+
   bool IsSuperReferral() const;
   std::string GetSuperReferralThemeName() const;
   std::string GetSuperReferralCode() const;
@@ -176,6 +181,7 @@ class NTPBackgroundImagesService {
   // not show SI images until user chooses Brave default images. So, we should
   // know the exact timing whether SR assets is ready to use or not.
   absl::optional<base::Value::Dict> initial_sr_component_info_;
+  NTPImageCache image_cache_;
   base::WeakPtrFactory<NTPBackgroundImagesService> weak_factory_;
 };
 
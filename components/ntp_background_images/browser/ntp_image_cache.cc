@@ -0,0 +1,160 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+absl::optional<std::string> ReadFileToString(const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return absl::optional<std::string>();
+  return contents;
+}
+
+}  // namespace
+
+NTPImageCache::PendingRead::PendingRead() = default;
+NTPImageCache::PendingRead::PendingRead(PendingRead&&) = default;
+NTPImageCache::PendingRead& NTPImageCache::PendingRead::operator=(
+    PendingRead&&) = default;
+NTPImageCache::PendingRead::~PendingRead() = default;
+
+NTPImageCache::NTPImageCache(size_t max_size_in_bytes)
+    : max_size_in_bytes_(max_size_in_bytes) {}
+
+NTPImageCache::~NTPImageCache() = default;
+
+void NTPImageCache::Get(const base::FilePath& path, GetCallback callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  auto cached = cache_.Get(path);
+  if (cached != cache_.end()) {
+    std::move(callback).Run(cached->second);
+    return;
+  }
+
+  auto& pending_read = pending_reads_[path];
+  pending_read.callbacks.push_back(std::move(callback));
+  if (pending_read.callbacks.size() > 1 && !pending_read.is_prefetch) {
+    // Another request is already reading this file.
+    return;
+  }
+  // A best effort prefetch can be delayed for a long time, so a tab that is
+  // waiting for the file reads it again at the usual priority. Whichever
+  // read finishes first answers all the callbacks.
+  pending_read.is_prefetch = false;
+  Read(path, base::TaskPriority::USER_BLOCKING);
+}
+
+void NTPImageCache::Prefetch(const base::FilePath& path) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (path.empty() || cache_.Peek(path) != cache_.end() ||
+      pending_reads_.contains(path)) {
+    return;
+  }
+
+  pending_reads_.emplace(path, PendingRead());
+  Read(path, base::TaskPriority::BEST_EFFORT);
+}
+
+void NTPImageCache::Clear() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  cache_.Clear();
+  size_in_bytes_ = 0;
+  generation_++;
+}
+
+void NTPImageCache::Read(const base::FilePath& path,
+                         base::TaskPriority priority) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), priority},
+      base::BindOnce(&ReadFileToString, path),
+      base::BindOnce(&NTPImageCache::OnRead, weak_factory_.GetWeakPtr(), path,
+                     generation_));
+}
+
+void NTPImageCache::OnRead(const base::FilePath& path,
+                           int generation,
+                           absl::optional<std::string> contents) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  auto pending_read = pending_reads_.find(path);
+  if (pending_read == pending_reads_.end()) {
+    // Already answered by an earlier read of the same file.
+    return;
+  }
+  std::vector<GetCallback> callbacks =
+      std::move(pending_read->second.callbacks);
+  pending_reads_.erase(pending_read);
+
+  scoped_refptr<base::RefCountedMemory> bytes;
+  if (contents) {
+    bytes = base::MakeRefCounted<base::RefCountedString>(std::move(*contents));
+    if (generation == generation_) {
+      Put(path, bytes);
+    }
+  }
+
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(bytes);
+  }
+}
+
+void NTPImageCache::Put(const base::FilePath& path,
+                        scoped_refptr<base::RefCountedMemory> bytes) {
+  if (bytes->size() > max_size_in_bytes_) {
+    return;
+  }
+
+  if (!memory_pressure_listener_) {
+    memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+        FROM_HERE, base::BindRepeating(&NTPImageCache::OnMemoryPressure,
+                                       weak_factory_.GetWeakPtr()));
+  }
+
+  auto existing = cache_.Peek(path);
+  if (existing != cache_.end()) {
+    size_in_bytes_ -= existing->second->size();
+    cache_.Erase(existing);
+  }
+  size_in_bytes_ += bytes->size();
+  cache_.Put(path, std::move(bytes));
+  EvictUntilSizeIsAtMost(max_size_in_bytes_);
+}
+
+void NTPImageCache::EvictUntilSizeIsAtMost(size_t max_size_in_bytes) {
+  while (size_in_bytes_ > max_size_in_bytes && !cache_.empty()) {
+    auto oldest = cache_.rbegin();
+    size_in_bytes_ -= oldest->second->size();
+    cache_.Erase(oldest);
+  }
+}
+
+void NTPImageCache::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  switch (level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      EvictUntilSizeIsAtMost(max_size_in_bytes_ / 2);
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      EvictUntilSizeIsAtMost(0);
+      break;
+  }
+}
+
+}  // namespace ntp_background_images
@@ -0,0 +1,95 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+#include "base/task/task_traits.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace ntp_background_images {
+
+// In-memory cache of NTP image files, shared by the background and sponsored
+// images sources. Every new tab shows one of a handful of wallpapers, so
+// keeping the most recently used files around saves reading them from disk
+// again. The cache is bounded by the total size of the files it holds and is
+// trimmed under memory pressure.
+class NTPImageCache {
+ public:
+  using GetCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  explicit NTPImageCache(size_t max_size_in_bytes);
+  ~NTPImageCache();
+
+  NTPImageCache(const NTPImageCache&) = delete;
+  NTPImageCache& operator=(const NTPImageCache&) = delete;
+
+  // Runs |callback| with the contents of |path|, or null if it can't be
+  // read. Cache hits are answered synchronously.
+  void Get(const base::FilePath& path, GetCallback callback);
+
+  // Reads |path| into the cache at best effort priority, e.g. for the
+  // wallpaper the next new tab will show.
+  void Prefetch(const base::FilePath& path);
+
+  // Drops all cached files. Reads that are in progress still answer their
+  // callbacks but aren't cached. Called when a component is updated.
+  void Clear();
+
+  size_t size_in_bytes() const { return size_in_bytes_; }
+
+ private:
+  struct PendingRead {
+    PendingRead();
+    PendingRead(PendingRead&&);
+    PendingRead& operator=(PendingRead&&);
+    ~PendingRead();
+
+    std::vector<GetCallback> callbacks;
+    bool is_prefetch = true;
+  };
+
+  void Read(const base::FilePath& path, base::TaskPriority priority);
+  void OnRead(const base::FilePath& path,
+              int generation,
+              absl::optional<std::string> contents);
+  void Put(const base::FilePath& path,
+           scoped_refptr<base::RefCountedMemory> bytes);
+  void EvictUntilSizeIsAtMost(size_t max_size_in_bytes);
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+
+  const size_t max_size_in_bytes_;
+  size_t size_in_bytes_ = 0;
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>> cache_{
+      base::LRUCache<base::FilePath,
+                     scoped_refptr<base::RefCountedMemory>>::NO_AUTO_EVICT};
+  base::flat_map<base::FilePath, PendingRead> pending_reads_;
+  // Incremented by Clear() so that reads started before it aren't cached.
+  int generation_ = 0;
+  // Created with the first cached file.
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  base::WeakPtrFactory<NTPImageCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
@@ -0,0 +1,142 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageCacheTest : public testing::Test {
+ public:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath WriteFile(const std::string& name,
+                           const std::string& contents) {
+    const base::FilePath path = temp_dir_.GetPath().AppendASCII(name);
+    EXPECT_TRUE(base::WriteFile(path, contents));
+    return path;
+  }
+
+  // Returns the contents served for |path|, or "<null>" if it couldn't be
+  // read.
+  std::string Get(NTPImageCache* cache, const base::FilePath& path) {
+    std::string result;
+    bool called = false;
+    cache->Get(path, base::BindLambdaForTesting(
+                         [&](scoped_refptr<base::RefCountedMemory> bytes) {
+                           called = true;
+                           result = bytes ? std::string(bytes->front_as<char>(),
+                                                        bytes->size())
+                                          : "<null>";
+                         }));
+    task_environment_.RunUntilIdle();
+    EXPECT_TRUE(called);
+    return result;
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(NTPImageCacheTest, ServesCachedContents) {
+  NTPImageCache cache(100);
+  const base::FilePath path = WriteFile("a.jpg", "aaaa");
+  EXPECT_EQ("aaaa", Get(&cache, path));
+  EXPECT_EQ(4u, cache.size_in_bytes());
+
+  // The second request doesn't touch the disk.
+  ASSERT_TRUE(base::DeleteFile(path));
+  EXPECT_EQ("aaaa", Get(&cache, path));
+
+  EXPECT_EQ("<null>", Get(&cache, temp_dir_.GetPath().AppendASCII("b.jpg")));
+}
+
+TEST_F(NTPImageCacheTest, EvictsLeastRecentlyUsed) {
+  NTPImageCache cache(10);
+  const base::FilePath a = WriteFile("a.jpg", "aaaa");
+  const base::FilePath b = WriteFile("b.jpg", "bbbb");
+  const base::FilePath c = WriteFile("c.jpg", "cccc");
+  const base::FilePath big = WriteFile("big.jpg", std::string(11, 'x'));
+
+  Get(&cache, a);
+  Get(&cache, b);
+  // Touch |a| so that |b| is the oldest entry.
+  Get(&cache, a);
+  Get(&cache, c);
+  EXPECT_EQ(8u, cache.size_in_bytes());
+
+  ASSERT_TRUE(base::DeleteFile(a));
+  ASSERT_TRUE(base::DeleteFile(b));
+  EXPECT_EQ("aaaa", Get(&cache, a));
+  EXPECT_EQ("<null>", Get(&cache, b));
+
+  // Files larger than the cache are served but not cached.
+  EXPECT_EQ(std::string(11, 'x'), Get(&cache, big));
+  EXPECT_EQ(8u, cache.size_in_bytes());
+}
+
+TEST_F(NTPImageCacheTest, Prefetch) {
+  NTPImageCache cache(100);
+  const base::FilePath path = WriteFile("a.jpg", "aaaa");
+  cache.Prefetch(path);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(4u, cache.size_in_bytes());
+
+  ASSERT_TRUE(base::DeleteFile(path));
+  EXPECT_EQ("aaaa", Get(&cache, path));
+}
+
+TEST_F(NTPImageCacheTest, GetWhilePrefetching) {
+  NTPImageCache cache(100);
+  const base::FilePath path = WriteFile("a.jpg", "aaaa");
+  cache.Prefetch(path);
+  EXPECT_EQ("aaaa", Get(&cache, path));
+  EXPECT_EQ(4u, cache.size_in_bytes());
+}
+
+TEST_F(NTPImageCacheTest, Clear) {
+  NTPImageCache cache(100);
+  const base::FilePath path = WriteFile("a.jpg", "aaaa");
+  EXPECT_EQ("aaaa", Get(&cache, path));
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.size_in_bytes());
+  ASSERT_TRUE(base::WriteFile(path, "updated"));
+  EXPECT_EQ("updated", Get(&cache, path));
+
+  // Reads that started before Clear() aren't cached.
+  cache.Prefetch(WriteFile("b.jpg", "bbbb"));
+  cache.Clear();
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(0u, cache.size_in_bytes());
+}
+
+TEST_F(NTPImageCacheTest, MemoryPressure) {
+  NTPImageCache cache(8);
+  Get(&cache, WriteFile("a.jpg", "aaaa"));
+  Get(&cache, WriteFile("b.jpg", "bbbb"));
+  EXPECT_EQ(8u, cache.size_in_bytes());
+
+  base::MemoryPressureListener::SimulatePressureNotification(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(4u, cache.size_in_bytes());
+
+  base::MemoryPressureListener::SimulatePressureNotification(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(0u, cache.size_in_bytes());
+}
+
+}  // namespace ntp_background_images
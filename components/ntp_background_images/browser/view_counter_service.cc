@@ -23,6 +23,7 @@
 #include "brave/components/brave_rewards/common/pref_names.h"
 #include "brave/components/ntp_background_images/browser/features.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
 #include "brave/components/ntp_background_images/browser/ntp_p3a_helper.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_images_data.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
@@ -320,6 +321,7 @@ void ViewCounterService::RegisterPageView() {
   service_->CheckNTPSIComponentUpdateIfNeeded();
   model_.RegisterPageView();
   MaybePrefetchNewTabPageAd();
+  PrefetchNextWallpaper();
 }
 
 void ViewCounterService::BrandedWallpaperLogoClicked(
@@ -425,6 +427,44 @@ void ViewCounterService::MaybePrefetchNewTabPageAd() {
   ads_service_->PrefetchNewTabPageAd();
 }
 
+void ViewCounterService::PrefetchNextWallpaper() {
+  NTPImageCache* image_cache = service_->image_cache();
+
+  if (ShouldShowBrandedWallpaper()) {
+    // With ads enabled the ads service picks the sponsored image when the tab
+    // is shown, so only the model's choice can be prefetched.
+    NTPSponsoredImagesData* images_data = GetCurrentBrandedWallpaperData();
+    const bool is_picked_by_ads = ads_service_ && ads_service_->IsEnabled() &&
+                                  images_data &&
+                                  !images_data->IsSuperReferral();
+    if (images_data && !is_picked_by_ads) {
+      size_t campaign_index;
+      size_t background_index;
+      std::tie(campaign_index, background_index) =
+          model_.GetCurrentBrandedImageIndex();
+      if (campaign_index < images_data->campaigns.size()) {
+        const auto& backgrounds =
+            images_data->campaigns[campaign_index].backgrounds;
+        if (background_index < backgrounds.size()) {
+          image_cache->Prefetch(backgrounds[background_index].image_file);
+          image_cache->Prefetch(backgrounds[background_index].logo.image_file);
+        }
+      }
+      return;
+    }
+  }
+
+  if (!IsBackgroundWallpaperActive() || ShouldShowCustomBackground()) {
+    return;
+  }
+  NTPBackgroundImagesData* images_data = GetCurrentWallpaperData();
+  const int index = model_.current_wallpaper_image_index();
+  if (images_data && index >= 0 &&
+      static_cast<size_t>(index) < images_data->backgrounds.size()) {
+    image_cache->Prefetch(images_data->backgrounds[index].image_file);
+  }
+}
+
 void ViewCounterService::UpdateP3AValues() const {
   uint64_t new_tab_count = new_tab_count_state_->GetHighestValueInWeek();
   p3a_utils::RecordToHistogramBucket("Brave.NTP.NewTabsCreated",
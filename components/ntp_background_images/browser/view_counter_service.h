@@ -156,6 +156,8 @@ class ViewCounterService : public KeyedService,
   void ResetModel();
 
   void MaybePrefetchNewTabPageAd();
+  // Reads the images the next new tab is likely to show into the image cache.
+  void PrefetchNextWallpaper();
 
   void UpdateP3AValues() const;
 
@@ -0,0 +1,86 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/topsites_index.h"
+
+#include <map>
+#include <utility>
+
+#include "base/check.h"
+
+namespace {
+
+constexpr size_t kMaxGramLength = 3;
+
+}  // namespace
+
+TopSitesIndex::TopSitesIndex(const std::vector<std::string>& sites)
+    : sites_(sites) {
+  std::map<std::string, Postings> grams;
+  for (size_t i = 0; i < sites.size(); ++i) {
+    const std::string& site = sites[i];
+    for (size_t length = 1; length <= kMaxGramLength; ++length) {
+      for (size_t start = 0; start + length <= site.length(); ++start) {
+        Postings& postings = grams[site.substr(start, length)];
+        // Sites are visited in order, so postings stay sorted and a repeated
+        // n-gram within a site is always the last entry.
+        if (postings.empty() || postings.back() != i) {
+          postings.push_back(static_cast<uint32_t>(i));
+        }
+      }
+    }
+  }
+  grams_ = base::flat_map<std::string, Postings>(
+      std::make_move_iterator(grams.begin()),
+      std::make_move_iterator(grams.end()));
+}
+
+TopSitesIndex::~TopSitesIndex() = default;
+
+std::vector<TopSitesIndex::Match> TopSitesIndex::FindMatches(
+    const std::string& input,
+    size_t max_matches) const {
+  std::vector<Match> matches;
+  if (input.empty()) {
+    // Every site contains the empty string at position 0.
+    for (size_t i = 0; i < sites_->size() && matches.size() < max_matches;
+         ++i) {
+      matches.push_back({i, 0});
+    }
+    return matches;
+  }
+
+  const Postings* candidates = nullptr;
+  if (input.length() <= kMaxGramLength) {
+    auto it = grams_.find(input);
+    if (it == grams_.end()) {
+      return matches;
+    }
+    candidates = &it->second;
+  } else {
+    for (size_t start = 0; start + kMaxGramLength <= input.length();
+         ++start) {
+      auto it = grams_.find(input.substr(start, kMaxGramLength));
+      if (it == grams_.end()) {
+        return matches;
+      }
+      if (!candidates || it->second.size() < candidates->size()) {
+        candidates = &it->second;
+      }
+    }
+  }
+  DCHECK(candidates);
+
+  for (uint32_t site_index : *candidates) {
+    if (matches.size() >= max_matches) {
+      break;
+    }
+    const size_t position = (*sites_)[site_index].find(input);
+    if (position != std::string::npos) {
+      matches.push_back({site_index, position});
+    }
+  }
+  return matches;
+}
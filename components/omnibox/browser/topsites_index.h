@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_TOPSITES_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_TOPSITES_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ref.h"
+
+// N-gram inverted index over a fixed list of sites. Lets TopSitesProvider find
+// the sites containing the omnibox input by looking at a handful of
+// candidates instead of scanning the whole list on every keystroke.
+class TopSitesIndex {
+ public:
+  struct Match {
+    // Index of the site in the list the index was built from.
+    size_t site_index;
+    // Position of the first occurrence of the input in the site.
+    size_t position;
+  };
+
+  // |sites| must outlive the index.
+  explicit TopSitesIndex(const std::vector<std::string>& sites);
+  ~TopSitesIndex();
+
+  TopSitesIndex(const TopSitesIndex&) = delete;
+  TopSitesIndex& operator=(const TopSitesIndex&) = delete;
+
+  // Returns the first |max_matches| sites that contain |input|, in list
+  // order. This is the same result as calling std::string::find() on every
+  // site.
+  std::vector<Match> FindMatches(const std::string& input,
+                                 size_t max_matches) const;
+
+ private:
+  // Sorted indices of the sites that contain a given n-gram.
+  using Postings = std::vector<uint32_t>;
+
+  const raw_ref<const std::vector<std::string>> sites_;
+  // Postings for every 1, 2 and 3 character substring of the sites. Inputs
+  // up to three characters are answered exactly by a single lookup; longer
+  // inputs are checked against the sites of their rarest trigram.
+  base::flat_map<std::string, Postings> grams_;
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_TOPSITES_INDEX_H_
@@ -10,11 +10,13 @@
 #include <vector>
 
 #include "base/compiler_specific.h"
+#include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "components/omnibox/browser/autocomplete_match.h"
 #include "components/omnibox/browser/autocomplete_provider.h"
 
 class AutocompleteProviderClient;
+class TopSitesIndex;
 
 // This is the provider for top Alexa 500 sites URLs
 class TopSitesProvider : public AutocompleteProvider {
@@ -27,12 +29,17 @@ class TopSitesProvider : public AutocompleteProvider {
   void Start(const AutocompleteInput& input, bool minimal_changes) override;
 
  private:
+  FRIEND_TEST_ALL_PREFIXES(TopSitesProviderTest, IndexMatchesLinearScan);
+
   ~TopSitesProvider() override;
 
   static const int kRelevance;
 
   static std::vector<std::string> top_sites_;
 
+  // Built from |top_sites_| on first use.
+  static const TopSitesIndex& GetIndex();
+
   void AddMatch(const std::u16string& match_string,
                 const ACMatchClassifications& styles);
 
@@ -5,9 +5,13 @@
 
 #include "brave/components/omnibox/browser/topsites_provider.h"
 
+#include <string>
+#include <vector>
+
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/omnibox/browser/brave_fake_autocomplete_provider_client.h"
 #include "brave/components/omnibox/browser/brave_omnibox_prefs.h"
+#include "brave/components/omnibox/browser/topsites_index.h"
 #include "components/omnibox/browser/mock_autocomplete_provider_client.h"
 #include "components/omnibox/browser/test_scheme_classifier.h"
 #include "components/prefs/testing_pref_service.h"
@@ -56,3 +60,83 @@ TEST_F(TopSitesProviderTest, NoMatchingWhenPrefIsOff) {
   provider_->Start(CreateAutocompleteInput("dex"), false);
   EXPECT_TRUE(provider_->matches().empty());
 }
+
+TEST_F(TopSitesProviderTest, MatchPositions) {
+  provider_->Start(CreateAutocompleteInput("GOOG"), false);
+  ASSERT_FALSE(provider_->matches().empty());
+  EXPECT_EQ(u"google.com", provider_->matches()[0].contents);
+  ASSERT_EQ(2u, provider_->matches()[0].contents_class.size());
+  EXPECT_EQ(4u, provider_->matches()[0].contents_class[1].offset);
+
+  provider_->Start(CreateAutocompleteInput("ail.goo"), false);
+  ASSERT_FALSE(provider_->matches().empty());
+  EXPECT_EQ(u"mail.google.com", provider_->matches()[0].contents);
+  ASSERT_EQ(3u, provider_->matches()[0].contents_class.size());
+  EXPECT_EQ(0u, provider_->matches()[0].contents_class[0].offset);
+  EXPECT_EQ(1u, provider_->matches()[0].contents_class[1].offset);
+  EXPECT_EQ(8u, provider_->matches()[0].contents_class[2].offset);
+}
+
+TEST(TopSitesIndexTest, FindMatches) {
+  const std::vector<std::string> sites = {"abcabc.com", "bca.org", "xyz.net",
+                                          "abcd.com"};
+  TopSitesIndex index(sites);
+
+  auto matches = index.FindMatches("bc", 10);
+  ASSERT_EQ(3u, matches.size());
+  EXPECT_EQ(0u, matches[0].site_index);
+  EXPECT_EQ(1u, matches[0].position);
+  EXPECT_EQ(1u, matches[1].site_index);
+  EXPECT_EQ(0u, matches[1].position);
+  EXPECT_EQ(3u, matches[2].site_index);
+
+  // Every trigram of "abca.org" is indexed but no site contains it.
+  EXPECT_TRUE(index.FindMatches("abca.org", 10).empty());
+  EXPECT_TRUE(index.FindMatches("q", 10).empty());
+
+  matches = index.FindMatches(".com", 1);
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ(0u, matches[0].site_index);
+  EXPECT_EQ(6u, matches[0].position);
+
+  EXPECT_EQ(2u, index.FindMatches("", 2).size());
+}
+
+// The index must return exactly what a linear scan of the list with
+// std::string::find() would, for any input.
+TEST_F(TopSitesProviderTest, IndexMatchesLinearScan) {
+  const std::vector<std::string>& sites = TopSitesProvider::top_sites_;
+  const TopSitesIndex& index = TopSitesProvider::GetIndex();
+
+  std::vector<std::string> inputs = {"", "zzz", "google.comx", "-", "..",
+                                     "www.", "q.com"};
+  for (const auto& site : sites) {
+    for (size_t length = 1; length <= 6; ++length) {
+      for (size_t start = 0; start + length <= site.length(); ++start) {
+        inputs.push_back(site.substr(start, length));
+      }
+    }
+    inputs.push_back(site);
+    inputs.push_back(site + "/");
+  }
+
+  for (const auto& input : inputs) {
+    for (size_t max_matches : {size_t{3}, sites.size()}) {
+      std::vector<TopSitesIndex::Match> expected;
+      for (size_t i = 0; i < sites.size() && expected.size() < max_matches;
+           ++i) {
+        const size_t position = sites[i].find(input);
+        if (position != std::string::npos) {
+          expected.push_back({i, position});
+        }
+      }
+
+      const auto actual = index.FindMatches(input, max_matches);
+      ASSERT_EQ(expected.size(), actual.size()) << input;
+      for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i].site_index, actual[i].site_index) << input;
+        EXPECT_EQ(expected[i].position, actual[i].position) << input;
+      }
+    }
+  }
+}
@@ -113,17 +113,32 @@ void MessageManager::Init(
 
 void MessageManager::UpdateMetricValue(base::StringPiece histogram_name,
                                        size_t bucket) {
-  MetricLogType log_type = GetLogTypeForHistogram(histogram_name);
-  if (features::IsConstellationEnabled()) {
-    if (log_type == MetricLogType::kTypical) {
-      // Only update typical metrics, until express/slow Constellation metrics
-      // are supported
-      constellation_prep_log_store_->UpdateValue(std::string(histogram_name),
-                                                 bucket);
+  UpdateMetricValues({{std::string(histogram_name), bucket}});
+}
+
+void MessageManager::UpdateMetricValues(
+    const base::flat_map<std::string, size_t>& buckets) {
+  base::flat_map<MetricLogType, base::flat_map<std::string, uint64_t>>
+      json_values;
+  base::flat_map<std::string, uint64_t> constellation_values;
+  for (const auto& [histogram_name, bucket] : buckets) {
+    MetricLogType log_type = GetLogTypeForHistogram(histogram_name);
+    if (features::IsConstellationEnabled()) {
+      if (log_type == MetricLogType::kTypical) {
+        // Only update typical metrics, until express/slow Constellation
+        // metrics are supported
+        constellation_values.emplace(histogram_name, bucket);
+      }
     }
+    json_values[log_type].emplace(histogram_name, bucket);
+  }
+
+  if (!constellation_values.empty()) {
+    constellation_prep_log_store_->UpdateValues(constellation_values);
+  }
+  for (const auto& [log_type, values] : json_values) {
+    json_log_stores_[log_type]->UpdateValues(values);
   }
-  json_log_stores_[log_type].get()->UpdateValue(std::string(histogram_name),
-                                                bucket);
 }
 
 void MessageManager::RemoveMetricValue(base::StringPiece histogram_name) {
@@ -77,6 +77,8 @@ class MessageManager : public MetricLogStore::Delegate {
   void Init(scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
 
   void UpdateMetricValue(base::StringPiece histogram_name, size_t bucket);
+  // Updates several metrics with one pref update per affected log store.
+  void UpdateMetricValues(const base::flat_map<std::string, size_t>& buckets);
 
   void RemoveMetricValue(base::StringPiece histogram_name);
 
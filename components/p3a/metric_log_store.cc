@@ -97,13 +97,32 @@ const char* MetricLogStore::GetPrefName() const {
 
 void MetricLogStore::UpdateValue(const std::string& histogram_name,
                                  uint64_t value) {
-  if (is_constellation_) {
-    if (IsMetricP2A(histogram_name) || IsMetricCreative(histogram_name)) {
-      // Only non-creative P3A metrics are currently supported for
-      // Constellation.
-      return;
+  UpdateValues({{histogram_name, value}});
+}
+
+void MetricLogStore::UpdateValues(
+    const base::flat_map<std::string, uint64_t>& values) {
+  // Update the persistent values. The update is only created once there is
+  // something to write, since it marks the pref as changed when destroyed.
+  absl::optional<ScopedDictPrefUpdate> update;
+  for (const auto& [histogram_name, value] : values) {
+    if (is_constellation_) {
+      if (IsMetricP2A(histogram_name) || IsMetricCreative(histogram_name)) {
+        // Only non-creative P3A metrics are currently supported for
+        // Constellation.
+        continue;
+      }
     }
+    if (!update) {
+      update.emplace(&*local_state_, GetPrefName());
+    }
+    UpdateEntry(histogram_name, value, update->Get());
   }
+}
+
+void MetricLogStore::UpdateEntry(const std::string& histogram_name,
+                                 uint64_t value,
+                                 base::Value::Dict& log_dict) {
   LogEntry& entry = log_[histogram_name];
   entry.value = value;
 
@@ -112,11 +131,9 @@ void MetricLogStore::UpdateValue(const std::string& histogram_name,
     unsent_entries_.insert(histogram_name);
   }
 
-  // Update the persistent value.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
-  base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
-  log_dict->Set(kLogValueKey, base::NumberToString(value));
-  log_dict->Set(kLogSentKey, entry.sent);
+  base::Value::Dict* entry_dict = log_dict.EnsureDict(histogram_name);
+  entry_dict->Set(kLogValueKey, base::NumberToString(value));
+  entry_dict->Set(kLogSentKey, entry.sent);
 }
 
 void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
@@ -13,6 +13,7 @@
 #include "base/memory/raw_ref.h"
 #include "base/strings/string_piece.h"
 #include "base/time/time.h"
+#include "base/values.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "components/metrics/log_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -54,6 +55,9 @@ class MetricLogStore : public metrics::LogStore {
   static void RegisterPrefs(PrefRegistrySimple* registry);
 
   void UpdateValue(const std::string& histogram_name, uint64_t value);
+  // Same as calling UpdateValue() for each entry, but persists all of them
+  // with a single pref update.
+  void UpdateValues(const base::flat_map<std::string, uint64_t>& values);
   // Removes and also unstages the metric value if it is known and/or staged.
   void RemoveValueIfExists(const std::string& histogram_name);
   // Marks all saved values as unsent.
@@ -98,6 +102,11 @@ class MetricLogStore : public metrics::LogStore {
 
   const char* GetPrefName() const;
 
+  // Updates the in-memory entry and its persisted copy in |log_dict|.
+  void UpdateEntry(const std::string& histogram_name,
+                   uint64_t value,
+                   base::Value::Dict& log_dict);
+
   const raw_ref<Delegate> delegate_;
   const raw_ref<PrefService> local_state_;
 
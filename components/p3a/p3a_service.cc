@@ -17,6 +17,7 @@
 #include "base/notreached.h"
 #include "base/rand_util.h"
 #include "base/strings/string_piece_forward.h"
+#include "base/time/time.h"
 #include "base/timer/wall_clock_timer.h"
 #include "base/trace_event/trace_event.h"
 #include "brave/components/brave_stats/browser/brave_stats_updater_util.h"
@@ -51,6 +52,11 @@ const uint64_t kSuspendedMetricBucket = INT_MAX - 1;
 
 constexpr char kDynamicMetricsDictPref[] = "p3a.dynamic_metrics";
 
+// How long histogram values are buffered before they are handed to the UI
+// thread. Bursts of samples within this window cost one task and one pref
+// update per log store.
+constexpr base::TimeDelta kHistogramFlushDelay = base::Milliseconds(500);
+
 bool IsSuspendedMetric(base::StringPiece metric_name,
                        uint64_t value_or_bucket) {
   return value_or_bucket == kSuspendedMetricBucket;
@@ -178,9 +184,7 @@ void P3AService::Init(
   VLOG(2) << "P3AService::Init() Done!";
 
   // Store values that were recorded between calling constructor and |Init()|.
-  for (const auto& entry : histogram_values_) {
-    HandleHistogramChange(std::string(entry.first), entry.second);
-  }
+  HandleHistogramChanges(std::move(histogram_values_));
   histogram_values_ = {};
 }
 
@@ -229,10 +233,7 @@ void P3AService::OnHistogramChanged(const char* histogram_name,
   // Shortcut for the special values, see |kSuspendedMetricValue|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    GetUIThreadTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&P3AService::OnHistogramChangedOnUI, this,
-                                  histogram_name, kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    QueueHistogramValue(histogram_name, kSuspendedMetricBucket);
     return;
   }
 
@@ -261,31 +262,64 @@ void P3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  GetUIThreadTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&P3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  QueueHistogramValue(histogram_name, bucket);
 }
 
-void P3AService::OnHistogramChangedOnUI(const char* histogram_name,
-                                        base::HistogramBase::Sample sample,
-                                        size_t bucket) {
+void P3AService::QueueHistogramValue(const char* histogram_name,
+                                     size_t bucket) {
   VLOG(2) << "P3AService::OnHistogramChanged: histogram_name = "
-          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
+          << histogram_name << " bucket = " << bucket;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    const bool flush_pending = !pending_histogram_values_.empty();
+    // Only the latest bucket matters, earlier ones would be overwritten in
+    // the log store anyway.
+    pending_histogram_values_.insert_or_assign(histogram_name, bucket);
+    if (flush_pending) {
+      return;
+    }
+  }
+
+  GetUIThreadTaskRunner()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&P3AService::FlushPendingHistogramValues, this),
+      kHistogramFlushDelay);
+}
+
+void P3AService::FlushPendingHistogramValues() {
+  DCheckCurrentlyOnUIThread();
+
+  base::flat_map<std::string, size_t> values;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    values.swap(pending_histogram_values_);
+  }
+  if (values.empty()) {
+    return;
+  }
+
   if (!initialized_) {
     // Will handle it later when ready.
-    histogram_values_[histogram_name] = bucket;
-  } else {
-    HandleHistogramChange(histogram_name, bucket);
+    for (auto& [histogram_name, bucket] : values) {
+      histogram_values_.insert_or_assign(std::move(histogram_name), bucket);
+    }
+    return;
   }
+  HandleHistogramChanges(std::move(values));
 }
 
-void P3AService::HandleHistogramChange(base::StringPiece histogram_name,
-                                       size_t bucket) {
-  if (IsSuspendedMetric(histogram_name, bucket)) {
-    message_manager_->RemoveMetricValue(std::string(histogram_name));
-    return;
+void P3AService::HandleHistogramChanges(
+    base::flat_map<std::string, size_t> values) {
+  base::EraseIf(values, [this](const auto& entry) {
+    if (IsSuspendedMetric(entry.first, entry.second)) {
+      message_manager_->RemoveMetricValue(entry.first);
+      return true;
+    }
+    return false;
+  });
+  if (!values.empty()) {
+    message_manager_->UpdateMetricValues(values);
   }
-  message_manager_->UpdateMetricValue(std::string(histogram_name), bucket);
 }
 
 void P3AService::DisableStarAttestationForTesting() {
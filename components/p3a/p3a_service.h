@@ -17,6 +17,8 @@
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
 #include "base/strings/string_piece_forward.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "brave/components/p3a/message_manager.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/p3a_config.h"
@@ -80,11 +82,17 @@ class P3AService : public base::RefCountedThreadSafe<P3AService>,
   void Init(scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
 
   // Invoked by callbacks registered by our service. Since these callbacks
-  // can fire on any thread, this method reposts everything to UI thread.
+  // can fire on any thread, this method buffers the resulting buckets and
+  // flushes them to the UI thread in batches, keeping only the latest bucket
+  // per histogram.
   void OnHistogramChanged(const char* histogram_name,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
+  // Hands buffered histogram values to the message manager right away.
+  // Called on shutdown so that recent samples aren't lost.
+  void FlushPendingHistogramValues();
+
   // P3AMessageManager::Delegate
   void OnRotation(MetricLogType log_type, bool is_constellation) override;
   void OnMetricCycled(const std::string& histogram_name,
@@ -102,12 +110,10 @@ class P3AService : public base::RefCountedThreadSafe<P3AService>,
 
   void LoadDynamicMetrics();
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
-                              base::HistogramBase::Sample sample,
-                              size_t bucket);
+  void QueueHistogramValue(const char* histogram_name, size_t bucket);
 
-  // Updates or removes a metric from the log.
-  void HandleHistogramChange(base::StringPiece histogram_name, size_t bucket);
+  // Updates or removes metrics from the log.
+  void HandleHistogramChanges(base::flat_map<std::string, size_t> values);
 
   // General prefs:
   bool initialized_ = false;
@@ -126,7 +132,13 @@ class P3AService : public base::RefCountedThreadSafe<P3AService>,
 
   // Used to store histogram values that are produced between constructing
   // the service and its initialization.
-  base::flat_map<base::StringPiece, size_t> histogram_values_;
+  base::flat_map<std::string, size_t> histogram_values_;
+
+  // Buckets recorded on any thread that haven't been flushed to the UI thread
+  // yet. A flush task is pending whenever this is non-empty.
+  base::Lock pending_histogram_values_lock_;
+  base::flat_map<std::string, size_t> pending_histogram_values_
+      GUARDED_BY(pending_histogram_values_lock_);
 
   std::vector<
       std::unique_ptr<base::StatisticsRecorder::ScopedHistogramSampleObserver>>
@@ -21,6 +21,7 @@
 #include "brave/components/p3a/p3a_config.h"
 #include "brave/components/p3a/pref_names.h"
 #include "brave/components/p3a/switches.h"
+#include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/testing_pref_service.h"
 #include "content/public/test/browser_task_environment.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -344,6 +345,34 @@ TEST_F(P3AServiceTest, MetricSentCallback) {
   }
 }
 
+TEST_F(P3AServiceTest, CoalescesHistogramBursts) {
+  SetUpP3AService();
+  const std::string histogram_name = GetTestHistogramNames(1, 0).front();
+
+  int pref_updates = 0;
+  PrefChangeRegistrar registrar;
+  registrar.Init(&local_state_);
+  registrar.Add("p3a.logs", base::BindLambdaForTesting(
+                                [&pref_updates]() { ++pref_updates; }));
+
+  for (int i = 0; i < 1000; i++) {
+    base::UmaHistogramExactLinear(histogram_name, i % 8, 8);
+    p3a_service_->OnHistogramChanged(histogram_name.c_str(), 0, i % 8);
+  }
+
+  // Nothing is written until the buffer is flushed.
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(pref_updates, 0);
+
+  task_environment_.FastForwardBy(base::Seconds(1));
+  EXPECT_EQ(pref_updates, 1);
+  const auto* value = local_state_.GetDict("p3a.logs").FindStringByDottedPath(
+      histogram_name + ".value");
+  ASSERT_TRUE(value);
+  // Only the last bucket is kept.
+  EXPECT_EQ(*value, "7");
+}
+
 TEST_F(P3AServiceTest, ShouldNotSendIfDisabled) {
   SetUpP3AService();
   std::vector<std::string> test_histograms = GetTestHistogramNames(3, 3);
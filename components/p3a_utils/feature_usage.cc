@@ -151,21 +151,35 @@ void RecordFeatureDaysInMonthUsed(PrefService* prefs,
                                   const char* histogram_name,
                                   bool write_to_histogram) {
   DCHECK(prefs);
-  DCHECK(last_use_time_pref_name);
   DCHECK(days_in_month_used_pref_name);
+
+  MonthlyStorage storage(prefs, days_in_month_used_pref_name);
+  RecordFeatureDaysInMonthUsed(prefs, &storage, add_date,
+                               last_use_time_pref_name, histogram_name,
+                               write_to_histogram);
+}
+
+void RecordFeatureDaysInMonthUsed(PrefService* prefs,
+                                  MonthlyStorage* days_in_month_storage,
+                                  const base::Time& add_date,
+                                  const char* last_use_time_pref_name,
+                                  const char* histogram_name,
+                                  bool write_to_histogram) {
+  DCHECK(prefs);
+  DCHECK(days_in_month_storage);
+  DCHECK(last_use_time_pref_name);
   DCHECK(histogram_name);
 
   if (prefs->GetTime(last_use_time_pref_name).is_null()) {
     // Don't report if feature was never used
     return;
   }
-  MonthlyStorage storage(prefs, days_in_month_used_pref_name);
   if (!add_date.is_null()) {
-    storage.ReplaceIfGreaterForDate(add_date, 1);
+    days_in_month_storage->ReplaceIfGreaterForDate(add_date, 1);
   }
   if (write_to_histogram) {
     RecordToHistogramBucket(histogram_name, kDaysInMonthBuckets,
-                            storage.GetMonthlySum());
+                            days_in_month_storage->GetMonthlySum());
   }
 }
 
@@ -186,14 +200,22 @@ void RecordFeatureDaysInWeekUsed(PrefService* prefs,
                                  const char* histogram_name) {
   DCHECK(prefs);
   DCHECK(days_in_week_used_pref_name);
-  DCHECK(histogram_name);
 
   WeeklyStorage storage(prefs, days_in_week_used_pref_name);
+  RecordFeatureDaysInWeekUsed(&storage, is_add, histogram_name);
+}
+
+void RecordFeatureDaysInWeekUsed(WeeklyStorage* days_in_week_storage,
+                                 bool is_add,
+                                 const char* histogram_name) {
+  DCHECK(days_in_week_storage);
+  DCHECK(histogram_name);
+
   if (is_add) {
-    storage.ReplaceTodaysValueIfGreater(1);
+    days_in_week_storage->ReplaceTodaysValueIfGreater(1);
   }
 
-  auto sum = storage.GetWeeklySum();
+  auto sum = days_in_week_storage->GetWeeklySum();
   if (sum == 0) {
     return;
   }
@@ -8,8 +8,10 @@
 
 #include "base/time/time.h"
 
+class MonthlyStorage;
 class PrefRegistrySimple;
 class PrefService;
+class WeeklyStorage;
 
 namespace p3a_utils {
 
@@ -99,6 +101,16 @@ void RecordFeatureDaysInMonthUsed(PrefService* prefs,
                                   const char* histogram_name,
                                   bool write_to_histogram = true);
 
+// Same as above, but adds feature usage to |days_in_month_storage|. Callers
+// that record several times can keep the storage around so that the updates
+// are written to prefs together.
+void RecordFeatureDaysInMonthUsed(PrefService* prefs,
+                                  MonthlyStorage* days_in_month_storage,
+                                  const base::Time& add_date,
+                                  const char* last_use_time_pref_name,
+                                  const char* histogram_name,
+                                  bool write_to_histogram = true);
+
 // Records the DaysInWeekUsed metric. Will only record histogram
 // value when sum is above 0. This is best used as an ephemeral metric,
 // so we can stop reporting when a user is no longer "active".
@@ -115,6 +127,12 @@ void RecordFeatureDaysInWeekUsed(PrefService* prefs,
                                  const char* days_in_week_used_pref_name,
                                  const char* histogram_name);
 
+// Same as above, but adds feature usage to |days_in_week_storage|, which
+// callers can keep around so that updates are written to prefs together.
+void RecordFeatureDaysInWeekUsed(WeeklyStorage* days_in_week_storage,
+                                 bool is_add,
+                                 const char* histogram_name);
+
 // Records the LastUsageTime metric. Will not report if feature never used.
 //
 // Question: As an opted in feature user, when was the last time I used the
@@ -5,7 +5,9 @@
 
 #include "brave/components/playlist/browser/playlist_data_source.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "base/files/file_path.h"
@@ -17,6 +19,7 @@
 #include "base/task/thread_pool.h"
 #include "base/task/thread_pool/thread_pool_instance.h"
 #include "brave/components/playlist/browser/playlist_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace playlist {
@@ -36,6 +39,28 @@ scoped_refptr<base::RefCountedMemory> ReadFileToString(
       contents.length());
 }
 
+struct DataRequest {
+  std::string id;
+  std::string type;
+};
+
+// Splits the path of a chrome-untrusted://playlist-data/<id>/<type>/ URL.
+absl::optional<DataRequest> ParseDataRequest(const GURL& url) {
+  const std::string path = content::URLDataSource::URLToRequestPath(url);
+  const auto pos = path.find("/");
+  if (pos == std::string::npos) {
+    return absl::nullopt;
+  }
+
+  DataRequest request;
+  request.id = path.substr(0, pos);
+  request.type = path.substr(pos);
+  request.type.erase(
+      std::remove(request.type.begin(), request.type.end(), '/'),
+      request.type.end());
+  return request;
+}
+
 }  // namespace
 
 PlaylistDataSource::PlaylistDataSource(PlaylistService* service)
@@ -55,34 +80,28 @@ void PlaylistDataSource::StartDataRequest(
     std::move(got_data_callback).Run(nullptr);
     return;
   }
-  std::string path = URLDataSource::URLToRequestPath(url);
-  std::string id;
-  std::string type_string;
-  if (auto pos = path.find("/"); pos != std::string::npos) {
-    id = std::string(path.begin(), path.begin() + pos);
-    type_string = std::string(path.begin() + pos, path.end());
-    type_string.erase(std::remove(type_string.begin(), type_string.end(), '/'),
-                      type_string.end());
-  } else {
+  const absl::optional<DataRequest> request = ParseDataRequest(url);
+  if (!request) {
     NOTREACHED() << "path is not in expected form: /id/{thumbnail,media}/ vs "
-                 << path;
+                 << URLDataSource::URLToRequestPath(url);
     std::move(got_data_callback).Run(nullptr);
     return;
   }
 
   base::FilePath data_path;
-  if (type_string == "thumbnail") {
-    if (!service_->GetThumbnailPath(id, &data_path)) {
+  if (request->type == "thumbnail") {
+    if (!service_->GetThumbnailPath(request->id, &data_path)) {
       std::move(got_data_callback).Run(nullptr);
       return;
     }
-  } else if (type_string == "media") {
-    if (!service_->GetMediaPath(id, &data_path)) {
+  } else if (request->type == "media") {
+    if (!service_->GetMediaPath(request->id, &data_path)) {
       std::move(got_data_callback).Run(nullptr);
       return;
     }
   } else {
-    NOTREACHED() << "type is neither of {thumbnail,media}/ : " << type_string;
+    NOTREACHED() << "type is neither of {thumbnail,media}/ : "
+                 << request->type;
     std::move(got_data_callback).Run(nullptr);
     return;
   }
@@ -105,28 +124,21 @@ void PlaylistDataSource::OnGotDataFile(
 }
 
 std::string PlaylistDataSource::GetMimeType(const GURL& url) {
-  const std::string path = URLDataSource::URLToRequestPath(url);
-  std::string id;
-  std::string type_string;
-  if (auto pos = path.find("/"); pos != std::string::npos) {
-    id = std::string(path.begin(), path.begin() + pos);
-    type_string = std::string(path.begin() + pos, path.end());
-    type_string.erase(std::remove(type_string.begin(), type_string.end(), '/'),
-                      type_string.end());
-  } else {
+  const absl::optional<DataRequest> request = ParseDataRequest(url);
+  if (!request) {
     NOTREACHED() << "path is not in expected form: /id/{thumbnail,media}/ vs "
-                 << path;
+                 << URLDataSource::URLToRequestPath(url);
     return std::string();
   }
 
-  if (type_string == "thumbnail")
+  if (request->type == "thumbnail")
     return "image/jpeg";
 
   // TODO(sko) Decide mime type based on the file extension.
-  if (type_string == "media")
+  if (request->type == "media")
     return "video/mp4";
 
-  NOTREACHED() << "type is neither of {thumbnail,media}/ : " << type_string;
+  NOTREACHED() << "type is neither of {thumbnail,media}/ : " << request->type;
   return std::string();
 }
 
@@ -134,4 +146,21 @@ bool PlaylistDataSource::AllowCaching() {
   return false;
 }
 
+bool PlaylistDataSource::GetFilePathForStreaming(const GURL& url,
+                                                 base::FilePath* path) {
+  // Media files can be hundreds of MB, so they are served from disk in chunks
+  // and by range rather than read into memory by StartDataRequest().
+  // Thumbnails are small and keep going through GetDataFile().
+  if (!service_) {
+    return false;
+  }
+
+  const absl::optional<DataRequest> request = ParseDataRequest(url);
+  if (!request || request->type != "media") {
+    return false;
+  }
+
+  return service_->GetMediaPath(request->id, path);
+}
+
 }  // namespace playlist
@@ -39,6 +39,7 @@ class PlaylistDataSource : public content::URLDataSource {
                         GotDataCallback got_data_callback) override;
   std::string GetMimeType(const GURL& url) override;
   bool AllowCaching() override;
+  bool GetFilePathForStreaming(const GURL& url, base::FilePath* path) override;
 
  private:
   void GetDataFile(const base::FilePath& data_path,
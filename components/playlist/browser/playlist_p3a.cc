@@ -32,7 +32,8 @@ constexpr int kFirstTimeOffsetBuckets[] = {0, 6, 13, 20, 27};
 PlaylistP3A::PlaylistP3A(PrefService* local_state,
                          base::Time browser_first_run_time)
     : local_state_(local_state),
-      browser_first_run_time_(browser_first_run_time) {
+      browser_first_run_time_(browser_first_run_time),
+      usage_weekly_storage_(local_state, kPlaylistUsageWeeklyStorage) {
   CHECK(local_state);
   SetUpTimer();
   Update(false);
@@ -60,8 +61,7 @@ void PlaylistP3A::SetUpTimer() {
 }
 
 void PlaylistP3A::Update(bool new_usage) {
-  p3a_utils::RecordFeatureDaysInWeekUsed(local_state_, new_usage,
-                                         kPlaylistUsageWeeklyStorage,
+  p3a_utils::RecordFeatureDaysInWeekUsed(&usage_weekly_storage_, new_usage,
                                          kUsageDaysInWeekHistogramName);
   p3a_utils::RecordFeatureLastUsageTimeMetric(
       local_state_, kPlaylistLastUsageTime, kLastUsageTimeHistogramName);
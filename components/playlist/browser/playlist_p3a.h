@@ -9,6 +9,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
 #include "base/timer/wall_clock_timer.h"
+#include "brave/components/time_period_storage/weekly_storage.h"
 
 class PrefService;
 
@@ -35,6 +36,7 @@ class PlaylistP3A {
 
   raw_ptr<PrefService> local_state_;
   base::Time browser_first_run_time_;
+  WeeklyStorage usage_weekly_storage_;
   base::WallClockTimer update_timer_;
 };
 
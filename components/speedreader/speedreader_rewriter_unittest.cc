@@ -4,16 +4,23 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <string>
+#include <utility>
 
 #include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
 #include "base/path_service.h"
+#include "base/run_loop.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
 #include "base/threading/thread_restrictions.h"
 #include "brave/components/constants/brave_paths.h"
 #include "brave/components/speedreader/common/features.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
+#include "brave/components/speedreader/speedreader_streaming_distiller.h"
+#include "brave/components/speedreader/speedreader_util.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 
@@ -200,4 +207,61 @@ TEST_P(SpeedreaderRewriterPagesTest, CheckPages) {
   }
 }
 
+class SpeedreaderStreamingDistillerTest : public SpeedreaderRewriterTestBase {
+ protected:
+  // Pumps |data| to a streaming distiller in |chunk_size| pieces.
+  std::pair<DistillationResult, std::string> Distill(const std::string& data,
+                                                     size_t chunk_size) {
+    auto rewriter = speedreader_.MakeRewriter("https://test.com");
+    rewriter->SetMinOutLength(100);
+    StreamingDistiller distiller(std::move(rewriter),
+                                 base::SequencedTaskRunner::GetCurrentDefault());
+    for (size_t offset = 0; offset < data.size(); offset += chunk_size) {
+      distiller.Write(data.substr(offset, chunk_size));
+    }
+
+    std::pair<DistillationResult, std::string> result;
+    base::RunLoop run_loop;
+    distiller.End(data, base::BindLambdaForTesting(
+                            [&](DistillationResult distillation_result,
+                                std::string original_data,
+                                std::string transformed) {
+                              EXPECT_EQ(data, original_data);
+                              result = {distillation_result,
+                                        std::move(transformed)};
+                              run_loop.Quit();
+                            }));
+    run_loop.Run();
+    return result;
+  }
+
+ private:
+  base::test::TaskEnvironment task_environment_;
+  SpeedReader speedreader_;
+};
+
+TEST_F(SpeedreaderStreamingDistillerTest, MatchesBufferedRewriter) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+
+  const std::string input_file = "meta_name_shortest_desc.html";
+  const auto expected = ProcessPage(input_file);
+  const auto data = GetFileContent(input_file);
+
+  for (size_t chunk_size : {size_t{1}, size_t{7}, size_t{512}, data.size()}) {
+    SCOPED_TRACE(chunk_size);
+    const auto result = Distill(data, chunk_size);
+    EXPECT_EQ(DistillationResult::kSuccess, result.first);
+    EXPECT_EQ(expected, result.second);
+  }
+}
+
+TEST_F(SpeedreaderStreamingDistillerTest, TooSmallOutput) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+
+  const auto data = GetFileContent("too_small_output.html");
+  const auto result = Distill(data, 64);
+  EXPECT_EQ(DistillationResult::kFail, result.first);
+  EXPECT_TRUE(result.second.empty());
+}
+
 }  // namespace speedreader
@@ -0,0 +1,94 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/speedreader/speedreader_streaming_distiller.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/task/task_traits.h"
+#include "base/task/thread_pool.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/components/speedreader/rust/ffi/speedreader.h"
+
+namespace speedreader {
+
+class StreamingDistiller::Core {
+ public:
+  explicit Core(std::unique_ptr<Rewriter> rewriter)
+      : rewriter_(std::move(rewriter)) {}
+  ~Core() = default;
+
+  Core(const Core&) = delete;
+  Core& operator=(const Core&) = delete;
+
+  void Write(std::string chunk) {
+    if (failed_) {
+      return;
+    }
+    base::ElapsedTimer timer;
+    // Non-zero means an error occurred, the rest of the body is dropped.
+    failed_ = rewriter_->Write(chunk.data(), chunk.size()) != 0;
+    elapsed_ += timer.Elapsed();
+  }
+
+  std::pair<DistillationResult, std::string> End() {
+    if (failed_) {
+      return {DistillationResult::kFail, std::string()};
+    }
+    base::ElapsedTimer timer;
+    rewriter_->End();
+    std::string transformed = rewriter_->GetOutput();
+    elapsed_ += timer.Elapsed();
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill", elapsed_);
+
+    // If the distillation failed, the rewriter returns an empty string.
+    if (transformed.length() < kMinDistilledLength) {
+      return {DistillationResult::kFail, std::string()};
+    }
+    return {DistillationResult::kSuccess, std::move(transformed)};
+  }
+
+ private:
+  std::unique_ptr<Rewriter> rewriter_;
+  bool failed_ = false;
+  base::TimeDelta elapsed_;
+};
+
+StreamingDistiller::StreamingDistiller(
+    std::unique_ptr<Rewriter> rewriter,
+    scoped_refptr<base::SequencedTaskRunner> task_runner)
+    : core_(std::move(task_runner), std::move(rewriter)) {}
+
+StreamingDistiller::~StreamingDistiller() = default;
+
+// static
+std::unique_ptr<StreamingDistiller> StreamingDistiller::Create(
+    std::unique_ptr<Rewriter> rewriter) {
+  return std::make_unique<StreamingDistiller>(
+      std::move(rewriter),
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::USER_BLOCKING,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}));
+}
+
+void StreamingDistiller::Write(std::string chunk) {
+  core_.AsyncCall(&Core::Write).WithArgs(std::move(chunk));
+}
+
+void StreamingDistiller::End(std::string original_data,
+                             DistillationResultCallback callback) {
+  core_.AsyncCall(&Core::End)
+      .Then(base::BindOnce(
+          [](std::string original_data, DistillationResultCallback callback,
+             std::pair<DistillationResult, std::string> result) {
+            std::move(callback).Run(result.first, std::move(original_data),
+                                    std::move(result.second));
+          },
+          std::move(original_data), std::move(callback)));
+}
+
+}  // namespace speedreader
@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_STREAMING_DISTILLER_H_
+#define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_STREAMING_DISTILLER_H_
+
+#include <memory>
+#include <string>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/threading/sequence_bound.h"
+#include "brave/components/speedreader/speedreader_util.h"
+
+namespace speedreader {
+
+class Rewriter;
+
+// Feeds a response body to a speedreader |Rewriter| chunk by chunk while it is
+// still being received. The rewriter lives on |task_runner|, so parsing the
+// document overlaps with the network transfer and only the readability
+// decision is left to do once the last byte arrives.
+class StreamingDistiller {
+ public:
+  StreamingDistiller(std::unique_ptr<Rewriter> rewriter,
+                     scoped_refptr<base::SequencedTaskRunner> task_runner);
+  ~StreamingDistiller();
+
+  StreamingDistiller(const StreamingDistiller&) = delete;
+  StreamingDistiller& operator=(const StreamingDistiller&) = delete;
+
+  // Creates a distiller backed by a fresh thread pool sequence.
+  static std::unique_ptr<StreamingDistiller> Create(
+      std::unique_ptr<Rewriter> rewriter);
+
+  // Pumps the next chunk of the body to the rewriter.
+  void Write(std::string chunk);
+
+  // Finishes the distillation. |original_data| is the whole body; it stays on
+  // the calling sequence and is handed back to |callback| untouched so the
+  // caller can fall back to it if the page isn't readable.
+  void End(std::string original_data, DistillationResultCallback callback);
+
+ private:
+  class Core;
+
+  base::SequenceBound<Core> core_;
+};
+
+}  // namespace speedreader
+
+#endif  // BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_STREAMING_DISTILLER_H_
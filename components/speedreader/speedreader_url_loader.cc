@@ -15,11 +15,10 @@
 #include "base/functional/bind.h"
 #include "base/memory/weak_ptr.h"
 #include "base/metrics/histogram_macros.h"
-#include "base/task/task_traits.h"
-#include "base/task/thread_pool.h"
 #include "brave/components/body_sniffer/body_sniffer_throttle.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
 #include "brave/components/speedreader/speedreader_service.h"
+#include "brave/components/speedreader/speedreader_streaming_distiller.h"
 #include "brave/components/speedreader/speedreader_throttle.h"
 #include "brave/components/speedreader/speedreader_throttle_delegate.h"
 #include "brave/components/speedreader/speedreader_util.h"
@@ -104,14 +103,27 @@ SpeedReaderURLLoader::~SpeedReaderURLLoader() = default;
 void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
   DCHECK_EQ(State::kLoading, state_);
 
+  const size_t start_size = buffered_body_.size();
   if (!BodySnifferURLLoader::CheckBufferedBody(kReadBufferSize)) {
     return;
   }
 
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+  // Pump the new chunk to the rewriter right away, so the page is parsed while
+  // the rest of it is still on the wire.
+  if (buffered_body_.size() > start_size) {
+    if (!distiller_) {
+      if (!rewriter_service_ || !speedreader_service_) {
+        Abort();
+        return;
+      }
+      distiller_ = StreamingDistiller::Create(rewriter_service_->MakeRewriter(
+          response_url_, speedreader_service_->GetThemeName(),
+          speedreader_service_->GetFontFamilyName(),
+          speedreader_service_->GetFontSizeName(),
+          speedreader_service_->GetContentStyleName()));
+    }
+    distiller_->Write(buffered_body_.substr(start_size));
+  }
 
   body_consumer_watcher_.ArmOrNotify();
 }
@@ -133,37 +145,36 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   }
 
   VLOG(2) << __func__ << " buffered body size = " << body.size();
-  bytes_remaining_in_buffer_ = body.size();
 
-  if (bytes_remaining_in_buffer_ > 0) {
-    speedreader::DistillPage(
-        response_url_, std::move(body), speedreader_service_, rewriter_service_,
-        base::BindOnce(
-            [](base::WeakPtr<SpeedReaderURLLoader> self, const GURL& url,
-               const std::string& stylesheet,
-               speedreader::DistillationResult result,
-               std::string original_data, std::string transformed) {
-              if (self) {
-                self->distillation_result_ = result;
-
-                if (result == speedreader::DistillationResult::kSuccess) {
-                  MaybeSaveDistilledDataForDebug(url, original_data, stylesheet,
-                                                 transformed);
-                  self->BodySnifferURLLoader::CompleteLoading(
-                      stylesheet + std::move(transformed));
-                } else {
-                  self->BodySnifferURLLoader::CompleteLoading(
-                      std::move(original_data));
-                }
-              }
-            },
-            weak_factory_.GetWeakPtr(), response_url_,
-            rewriter_service_->GetContentStylesheet()));
+  if (!body.empty() && distiller_) {
+    // The rewriter has already seen the whole body, only the readability
+    // decision is left.
+    distiller_->End(
+        std::move(body),
+        base::BindOnce(&SpeedReaderURLLoader::OnDistillComplete,
+                       weak_factory_.GetWeakPtr(),
+                       rewriter_service_->GetContentStylesheet()));
     return;
   }
   BodySnifferURLLoader::CompleteLoading(std::move(body));
 }
 
+void SpeedReaderURLLoader::OnDistillComplete(const std::string& stylesheet,
+                                             DistillationResult result,
+                                             std::string original_data,
+                                             std::string transformed) {
+  distiller_.reset();
+  distillation_result_ = result;
+
+  if (result == DistillationResult::kSuccess) {
+    MaybeSaveDistilledDataForDebug(response_url_, original_data, stylesheet,
+                                   transformed);
+    BodySnifferURLLoader::CompleteLoading(stylesheet + std::move(transformed));
+  } else {
+    BodySnifferURLLoader::CompleteLoading(std::move(original_data));
+  }
+}
+
 void SpeedReaderURLLoader::OnCompleteSending() {
   // TODO(keur, iefremov): This API could probably be improved with an enum
   // indicating distill success, distill fail, load from cache.
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -29,6 +30,7 @@ enum class DistillationResult : int;
 
 class SpeedreaderRewriterService;
 class SpeedreaderService;
+class StreamingDistiller;
 class SpeedReaderThrottle;
 class SpeedreaderThrottleDelegate;
 
@@ -43,12 +45,13 @@ class SpeedreaderThrottleDelegate;
 //               finished (= OnComplete() is called). When body is provided, the
 //               state is changed to kLoading. Otherwise the state goes to
 //               kCompleted.
-// kLoading: Receives the body from the source loader and distills the page.
-//            The received body is kept in this loader until distilling
-//            is finished. When all body has been received and distilling is
-//            done, this loader will dispatch queued messages like
-//            OnStartLoadingResponseBody() to the destination
-//            loader client, and then the state is changed to kSending.
+// kLoading: Receives the body from the source loader and pumps every chunk to
+//            the rewriter on a worker sequence as it arrives. The received
+//            body is kept in this loader until distilling is finished. When
+//            all body has been received and distilling is done, this loader
+//            will dispatch queued messages like OnStartLoadingResponseBody()
+//            to the destination loader client, and then the state is changed
+//            to kSending.
 // kSending: Receives the body and sends it to the destination loader client.
 //           The state changes to kCompleted after all data is sent.
 // kCompleted: All data has been sent to the destination loader.
@@ -87,6 +90,12 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
 
   void CompleteLoading(std::string body) override;
   void OnCompleteSending() override;
+
+  void OnDistillComplete(const std::string& stylesheet,
+                         DistillationResult result,
+                         std::string original_data,
+                         std::string transformed);
+
   base::WeakPtr<SpeedreaderThrottleDelegate> delegate_;
 
   GURL response_url_;
@@ -97,6 +106,9 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
 
   DistillationResult distillation_result_;
 
+  // Created with the first chunk of the body and fed as the rest arrives.
+  std::unique_ptr<StreamingDistiller> distiller_;
+
   base::WeakPtrFactory<SpeedReaderURLLoader> weak_factory_{this};
 };
 
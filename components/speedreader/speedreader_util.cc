@@ -98,7 +98,7 @@ void DistillPage(const GURL& url,
     // If the distillation failed, the rewriter returns an empty string. Also,
     // if the output is too small, we assume that the content of the distilled
     // page does not contain enough text to read.
-    if (transformed.length() < 1024) {
+    if (transformed.length() < kMinDistilledLength) {
       return {DistillationResult::kFail, std::move(data), std::string()};
     }
     return {DistillationResult::kSuccess, std::move(data), transformed};
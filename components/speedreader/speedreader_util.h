@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 
+#include <cstddef>
 #include <string>
 
 #include "base/functional/callback_forward.h"
@@ -59,6 +60,10 @@ enum class DistillState {
   kPageProbablyReadable,
 };
 
+// If the distilled output is smaller than this, we assume that the page does
+// not contain enough text to read.
+constexpr size_t kMinDistilledLength = 1024;
+
 enum class DistillationResult : int {
   kNone,
   kSuccess,
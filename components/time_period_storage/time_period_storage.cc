@@ -10,11 +10,19 @@
 #include <utility>
 
 #include "base/ranges/algorithm.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/time/clock.h"
 #include "base/time/default_clock.h"
 #include "base/values.h"
 #include "components/prefs/pref_service.h"
 
+namespace {
+
+// How long updates are kept in memory before being written to prefs.
+constexpr base::TimeDelta kSaveDelay = base::Seconds(10);
+
+}  // namespace
+
 TimePeriodStorage::TimePeriodStorage(PrefService* prefs,
                                      const char* pref_name,
                                      size_t period_days)
@@ -41,12 +49,14 @@ TimePeriodStorage::TimePeriodStorage(PrefService* prefs,
   Load();
 }
 
-TimePeriodStorage::~TimePeriodStorage() = default;
+TimePeriodStorage::~TimePeriodStorage() {
+  CommitPendingWrite();
+}
 
 void TimePeriodStorage::AddDelta(uint64_t delta) {
   FilterToPeriod();
   daily_values_.front().value += delta;
-  Save();
+  ScheduleSave();
 }
 
 void TimePeriodStorage::SubDelta(uint64_t delta) {
@@ -59,7 +69,7 @@ void TimePeriodStorage::SubDelta(uint64_t delta) {
     daily_value.value -= day_delta;
     delta -= day_delta;
   }
-  Save();
+  ScheduleSave();
 }
 
 void TimePeriodStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
@@ -68,14 +78,14 @@ void TimePeriodStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
   if (today.value < value) {
     today.value = value;
   }
-  Save();
+  ScheduleSave();
 }
 
 void TimePeriodStorage::ReplaceIfGreaterForDate(const base::Time& date,
                                                 uint64_t value) {
   FilterToPeriod();
   base::Time date_mn = date.LocalMidnight();
-  std::list<DailyValue>::iterator day_insert_it = base::ranges::find_if(
+  auto day_insert_it = base::ranges::find_if(
       daily_values_,
       [date_mn](const DailyValue& val) { return val.day <= date_mn; });
   if (day_insert_it != daily_values_.end() && day_insert_it->day == date_mn) {
@@ -86,7 +96,7 @@ void TimePeriodStorage::ReplaceIfGreaterForDate(const base::Time& date,
   } else {
     daily_values_.insert(day_insert_it, {date_mn, value});
   }
-  Save();
+  ScheduleSave();
 }
 
 uint64_t TimePeriodStorage::GetPeriodSumInTimeRange(
@@ -114,23 +124,13 @@ uint64_t TimePeriodStorage::GetPeriodSum() const {
 uint64_t TimePeriodStorage::GetHighestValueInPeriod() const {
   // We record only value for last N days.
   const base::Time n_days_ago = clock_->Now() - base::Days(period_days_);
-  std::list<DailyValue> in_period_daily_values(daily_values_.size());
-  auto copied_it =
-      std::copy_if(daily_values_.begin(), daily_values_.end(),
-                   in_period_daily_values.begin(),
-                   [n_days_ago](auto i) { return i.day > n_days_ago; });
-  in_period_daily_values.resize(
-      std::distance(in_period_daily_values.begin(), copied_it));
-
-  auto highest_it = std::max_element(in_period_daily_values.begin(),
-                                     in_period_daily_values.end(),
-                                     [](const auto& left, const auto& right) {
-                                       return left.value < right.value;
-                                     });
-  if (highest_it == in_period_daily_values.end()) {
-    return 0;
+  uint64_t highest = 0;
+  for (const DailyValue& daily_value : daily_values_) {
+    if (daily_value.day > n_days_ago) {
+      highest = std::max(highest, daily_value.value);
+    }
   }
-  return highest_it->value;
+  return highest;
 }
 
 bool TimePeriodStorage::IsOnePeriodPassed() const {
@@ -139,8 +139,21 @@ bool TimePeriodStorage::IsOnePeriodPassed() const {
   return daily_values_.size() == period_days_;
 }
 
+void TimePeriodStorage::CommitPendingWrite() {
+  if (save_timer_.IsRunning()) {
+    save_timer_.FireNow();
+  }
+}
+
 void TimePeriodStorage::FilterToPeriod() {
-  base::Time now_midnight = clock_->Now().LocalMidnight();
+  const base::Time now = clock_->Now();
+  if (!daily_values_.empty() && now >= daily_values_.front().day &&
+      now < next_day_start_) {
+    // Still the same day as the newest value.
+    return;
+  }
+
+  base::Time now_midnight = now.LocalMidnight();
   base::Time last_saved_midnight;
 
   if (!daily_values_.empty()) {
@@ -155,10 +168,16 @@ void TimePeriodStorage::FilterToPeriod() {
       daily_values_.pop_back();
     }
   }
+  // Days can be 23 or 25 hours long around DST changes, so look up the next
+  // midnight from the middle of the following day.
+  next_day_start_ =
+      (daily_values_.front().day + base::Days(1) + base::Hours(12))
+          .LocalMidnight();
 }
 
 void TimePeriodStorage::Load() {
   DCHECK(daily_values_.empty());
+  daily_values_.reserve(period_days_ + 1);
   const auto& list = prefs_->GetList(pref_name_);
   for (const auto& it : list) {
     DCHECK(it.is_dict());
@@ -176,13 +195,23 @@ void TimePeriodStorage::Load() {
   }
 }
 
+void TimePeriodStorage::ScheduleSave() {
+  if (!base::SequencedTaskRunner::HasCurrentDefault()) {
+    // Nothing to post the delayed write to.
+    Save();
+    return;
+  }
+  if (!save_timer_.IsRunning()) {
+    save_timer_.Start(FROM_HERE, kSaveDelay, this, &TimePeriodStorage::Save);
+  }
+}
+
 void TimePeriodStorage::Save() {
   DCHECK(!daily_values_.empty());
   DCHECK_LE(daily_values_.size(), period_days_);
 
   base::Value::List list;
-  // TODO(iefremov): Optimize if needed.
-  list.clear();
+  list.reserve(daily_values_.size());
   for (const auto& u : daily_values_) {
     base::Value::Dict value;
     value.Set("day", u.day.ToDoubleT());
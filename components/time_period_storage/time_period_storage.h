@@ -6,11 +6,12 @@
 #ifndef BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 #define BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 
-#include <list>
 #include <memory>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 
 namespace base {
 class Clock;
@@ -21,6 +22,9 @@ class PrefService;
 // Mostly used by various P3A recorders - allows to track a sum of some
 // values added from time to time via |AddDelta| over the last predefined time
 // period. Requires |pref_name| to be already registered.
+// Updates are kept in memory and written to |pref_name| after a short delay,
+// so bursts of |AddDelta| calls result in a single pref write. Pending updates
+// are also written when the storage is destroyed.
 class TimePeriodStorage {
  public:
   TimePeriodStorage(PrefService* prefs,
@@ -47,6 +51,9 @@ class TimePeriodStorage {
   uint64_t GetHighestValueInPeriod() const;
   bool IsOnePeriodPassed() const;
 
+  // Writes pending updates to prefs immediately.
+  void CommitPendingWrite();
+
  protected:
   std::unique_ptr<base::Clock> clock_;
 
@@ -57,13 +64,21 @@ class TimePeriodStorage {
   };
   void FilterToPeriod();
   void Load();
+  void ScheduleSave();
   void Save();
 
   const raw_ptr<PrefService> prefs_;
   const char* pref_name_ = nullptr;
   size_t period_days_;
 
-  std::list<DailyValue> daily_values_;
+  // Newest day first, holds at most |period_days_| entries outside of
+  // |ReplaceIfGreaterForDate|.
+  base::circular_deque<DailyValue> daily_values_;
+  // Start of the day after |daily_values_.front()|, cached so that
+  // |FilterToPeriod| doesn't have to compute the local midnight on every call.
+  base::Time next_day_start_;
+
+  base::OneShotTimer save_timer_;
 };
 
 #endif  // BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
@@ -10,6 +10,7 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/testing_pref_service.h"
@@ -31,6 +32,8 @@ class TimePeriodStorageTest : public ::testing::Test {
   }
 
  protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   raw_ptr<base::SimpleTestClock> clock_ = nullptr;
   TestingPrefServiceSimple pref_service_;
   std::unique_ptr<TimePeriodStorage> state_;
@@ -286,3 +289,43 @@ TEST_F(TimePeriodStorageTest, ReplaceIfGreaterForDate) {
   state_->ReplaceIfGreaterForDate(clock_->Now() - base::Days(31), 10);
   EXPECT_EQ(state_->GetPeriodSum(), 11U);
 }
+
+TEST_F(TimePeriodStorageTest, WritesBehind) {
+  InitStorage(7);
+  for (int i = 0; i < 1000; i++) {
+    state_->AddDelta(1);
+  }
+  EXPECT_EQ(state_->GetPeriodSum(), 1000U);
+  EXPECT_TRUE(pref_service_.GetList(kPrefName).empty());
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  const base::Value::List& list = pref_service_.GetList(kPrefName);
+  ASSERT_EQ(list.size(), 1U);
+  EXPECT_EQ(list[0].GetDict().FindDouble("value"), 1000);
+
+  // Pending updates are written on request and on destruction.
+  state_->AddDelta(5);
+  state_->CommitPendingWrite();
+  EXPECT_EQ(pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            1005);
+  state_->AddDelta(5);
+  state_.reset();
+  EXPECT_EQ(pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            1010);
+}
+
+TEST_F(TimePeriodStorageTest, LoadsSavedValues) {
+  InitStorage(7);
+  state_->AddDelta(3);
+  clock_->Advance(base::Days(1));
+  state_->AddDelta(4);
+  const base::Time now = clock_->Now();
+  state_.reset();
+
+  clock_ = new base::SimpleTestClock;
+  clock_->SetNow(now);
+  InitStorage(7);
+  EXPECT_EQ(state_->GetPeriodSum(), 7U);
+  clock_->Advance(base::Days(6));
+  EXPECT_EQ(state_->GetPeriodSum(), 4U);
+}
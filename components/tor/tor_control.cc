@@ -817,8 +817,10 @@ void TorControl::ReadDone(int rv) {
         // CRLF seen, so we must have i >= 2.  Emit a line and advance
         // to the next one, unless anything went wrong with the line.
         assert(i >= 1);
-        std::string line(readiobuf_->StartOfBuffer() + read_start_,
-                         readiobuf_->offset() + i - 1 - read_start_);
+        // The line is parsed in place; only what is handed to the delegate
+        // is copied.
+        base::StringPiece line(readiobuf_->StartOfBuffer() + read_start_,
+                               readiobuf_->offset() + i - 1 - read_start_);
         read_start_ = readiobuf_->offset() + i + 1;
         read_cr_ = false;
         if (!ReadLine(line)) {
@@ -874,9 +876,12 @@ void TorControl::ReadDone(int rv) {
 //      We have read a line of input; process it.  Return true on
 //      success, false on error.
 //
-bool TorControl::ReadLine(const std::string& line) {
+bool TorControl::ReadLine(base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
 
+  if (data_reply_)
+    return ReadDataLine(line);
+
   if (line.size() < 4) {
     // Line is too short.
     VLOG(1) << "tor: control line too short";
@@ -889,21 +894,34 @@ bool TorControl::ReadLine(const std::string& line) {
   // intermediate reply and ` ' for a final reply.
   //
   // TODO(riastradh): parse or check syntax of status
-  std::string status(line, 0, 3);
+  base::StringPiece status = line.substr(0, 3);
   char pos = line[3];
-  std::string reply(line, 4);
+  base::StringPiece reply = line.substr(4);
 
   // Determine whether it is an asynchronous reply, status 6yz.
   if (status[0] == '6') {
     // Notify delegate of the raw reply.
     NotifyTorRawAsync(status, reply);
 
+    // Data replies are only used by events we don't support (NS,
+    // NEWCONSENSUS, ...), so skip the data and the rest of the reply.
+    if (pos == '+') {
+      if (!async_) {
+        async_ = std::make_unique<Async>();
+        async_->event = TorControlEvent::INVALID;
+      }
+      async_->skip = true;
+      data_reply_ = std::make_unique<DataReply>();
+      data_reply_->skip = true;
+      return true;
+    }
+
     // Is this a new async reply?
     if (!async_) {
       // Parse the keyword and the initial line.
       const size_t sp = reply.find(' ');
-      std::string event_name, initial;
-      if (sp == std::string::npos) {
+      base::StringPiece event_name, initial;
+      if (sp == base::StringPiece::npos) {
         event_name = reply;
       } else {
         event_name = reply.substr(0, sp);
@@ -946,7 +964,7 @@ bool TorControl::ReadLine(const std::string& line) {
                                                      : (*found).second);
           async_ = std::make_unique<Async>();
           async_->event = event;
-          async_->initial = initial;
+          async_->initial = std::string(initial);
           async_->skip = (event == TorControlEvent::INVALID);
           return true;
         }
@@ -1018,19 +1036,25 @@ bool TorControl::ReadLine(const std::string& line) {
         NotifyTorRawMid(status, reply);
         if (!cmdq_.empty()) {
           PerLineCallback& perline = cmdq_.front().first;
-          perline.Run(status, reply);
+          perline.Run(std::string(status), std::string(reply));
         }
         return true;
       case '+':
-        VLOG(2) << "tor: NYI: control data reply";
-        // XXX Just ignore it for now.
+        // Start of a data reply.  The data lines that follow are
+        // collected by ReadDataLine() and handed to the command as one
+        // intermediate reply.
+        data_reply_ = std::make_unique<DataReply>();
+        data_reply_->status = std::string(status);
+        data_reply_->reply = std::string(reply);
+        data_reply_->skip = false;
         return true;
       case ' ':
         NotifyTorRawEnd(status, reply);
         if (!cmdq_.empty()) {
           CmdCallback& callback = cmdq_.front().second;
           bool error = false;
-          std::move(callback).Run(error, status, reply);
+          std::move(callback).Run(error, std::string(status),
+                                  std::string(reply));
           cmdq_.pop();
         }
         return true;
@@ -1044,9 +1068,49 @@ bool TorControl::ReadLine(const std::string& line) {
   return false;
 }
 
+// ReadDataLine(line)
+//
+//      We have read a line of a data reply; process it.  Data ends
+//      with a line containing only `.', and a leading `.' is escaped
+//      by doubling it.  Return true on success, false on error.
+//
+bool TorControl::ReadDataLine(base::StringPiece line) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  DCHECK(data_reply_);
+
+  if (line == ".") {
+    std::unique_ptr<DataReply> data_reply = std::move(data_reply_);
+    if (!data_reply->skip) {
+      NotifyTorRawMid(data_reply->status, data_reply->reply);
+      if (!cmdq_.empty()) {
+        PerLineCallback& perline = cmdq_.front().first;
+        perline.Run(data_reply->status, data_reply->reply);
+      }
+    }
+    return true;
+  }
+
+  if (data_reply_->skip)
+    return true;
+  if (base::StartsWith(line, "."))
+    line.remove_prefix(1);
+  data_reply_->reply.push_back('\n');
+  data_reply_->reply.append(line.data(), line.size());
+  return true;
+}
+
 TorControl::Async::Async() = default;
 TorControl::Async::~Async() = default;
 
+TorControl::DataReply::DataReply() = default;
+TorControl::DataReply::~DataReply() = default;
+
+TorControl::PendingBandwidth::PendingBandwidth() = default;
+TorControl::PendingBandwidth::PendingBandwidth(PendingBandwidth&&) = default;
+TorControl::PendingBandwidth& TorControl::PendingBandwidth::operator=(
+    PendingBandwidth&&) = default;
+TorControl::PendingBandwidth::~PendingBandwidth() = default;
+
 // Error()
 //
 //      Clear read and write state and disconnect.
@@ -1069,6 +1133,9 @@ void TorControl::Error() {
   readiobuf_.reset();
   read_start_ = -1;
   read_cr_ = false;
+  async_.reset();
+  data_reply_.reset();
+  pending_bandwidth_.reset();
 
   // Clear write state.
   writeq_ = {};
@@ -1092,44 +1159,108 @@ void TorControl::NotifyTorControlClosed() {
       base::BindOnce(&Delegate::OnTorControlClosed, delegate_, running_));
 }
 
+// NotifyTorEvent(event, initial, extra)
+//
+//      Post a parsed event to the delegate.  Bandwidth events are
+//      periodic samples that can arrive in bursts after a stall, so
+//      only the latest one read in the same task is posted, together
+//      with its raw line.  Any other notification posts the pending
+//      bandwidth event first, so the delegate still sees everything in
+//      the order it was read.
+//
 void TorControl::NotifyTorEvent(
     TorControlEvent event,
-    const std::string& initial,
+    base::StringPiece initial,
     const std::map<std::string, std::string>& extra) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  if (event == TorControlEvent::BW) {
+    PendingBandwidth& pending = GetPendingBandwidth();
+    pending.initial = std::string(initial);
+    pending.extra = extra;
+    pending.has_event = true;
+    return;
+  }
+  FlushPendingBandwidth();
   owner_task_runner_->PostTask(
-      FROM_HERE,
-      base::BindOnce(&Delegate::OnTorEvent, delegate_, event, initial, extra));
+      FROM_HERE, base::BindOnce(&Delegate::OnTorEvent, delegate_, event,
+                                std::string(initial), extra));
+}
+
+TorControl::PendingBandwidth& TorControl::GetPendingBandwidth() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  if (!pending_bandwidth_) {
+    pending_bandwidth_.emplace();
+    io_task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&TorControl::FlushPendingBandwidth,
+                                  weak_ptr_factory_.GetWeakPtr()));
+  }
+  return *pending_bandwidth_;
+}
+
+void TorControl::FlushPendingBandwidth() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  if (!pending_bandwidth_)
+    return;
+  PendingBandwidth pending = std::move(*pending_bandwidth_);
+  pending_bandwidth_.reset();
+  if (!pending.raw_line.empty()) {
+    owner_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&Delegate::OnTorRawAsync, delegate_,
+                       std::move(pending.raw_status),
+                       std::move(pending.raw_line)));
+  }
+  if (pending.has_event) {
+    owner_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&Delegate::OnTorEvent, delegate_, TorControlEvent::BW,
+                       std::move(pending.initial), std::move(pending.extra)));
+  }
 }
 
 void TorControl::NotifyTorRawCmd(const std::string& cmd) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  FlushPendingBandwidth();
   owner_task_runner_->PostTask(
       FROM_HERE, base::BindOnce(&Delegate::OnTorRawCmd, delegate_, cmd));
 }
 
-void TorControl::NotifyTorRawAsync(const std::string& status,
-                                   const std::string& line) {
+void TorControl::NotifyTorRawAsync(base::StringPiece status,
+                                   base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  // The raw line of a bandwidth event is held back with the event.
+  if (line == "BW" || base::StartsWith(line, "BW ")) {
+    PendingBandwidth& pending = GetPendingBandwidth();
+    pending.raw_status = std::string(status);
+    pending.raw_line = std::string(line);
+    pending.has_event = false;
+    return;
+  }
+  FlushPendingBandwidth();
   owner_task_runner_->PostTask(
       FROM_HERE,
-      base::BindOnce(&Delegate::OnTorRawAsync, delegate_, status, line));
+      base::BindOnce(&Delegate::OnTorRawAsync, delegate_, std::string(status),
+                     std::string(line)));
 }
 
-void TorControl::NotifyTorRawMid(const std::string& status,
-                                 const std::string& line) {
+void TorControl::NotifyTorRawMid(base::StringPiece status,
+                                 base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  FlushPendingBandwidth();
   owner_task_runner_->PostTask(
       FROM_HERE,
-      base::BindOnce(&Delegate::OnTorRawMid, delegate_, status, line));
+      base::BindOnce(&Delegate::OnTorRawMid, delegate_, std::string(status),
+                     std::string(line)));
 }
 
-void TorControl::NotifyTorRawEnd(const std::string& status,
-                                 const std::string& line) {
+void TorControl::NotifyTorRawEnd(base::StringPiece status,
+                                 base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  FlushPendingBandwidth();
   owner_task_runner_->PostTask(
       FROM_HERE,
-      base::BindOnce(&Delegate::OnTorRawEnd, delegate_, status, line));
+      base::BindOnce(&Delegate::OnTorRawEnd, delegate_, std::string(status),
+                     std::string(line)));
 }
 
 // ParseKV(string, key, value)
@@ -1139,7 +1270,7 @@ void TorControl::NotifyTorRawEnd(const std::string& status,
 //      success, false on failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value) {
   size_t end;
@@ -1154,20 +1285,20 @@ bool TorControl::ParseKV(const std::string& string,
 //      failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value,
                          size_t* end) {
   DCHECK(key && value && end);
   // Search for `=' -- it had better be there.
-  size_t eq = string.find("=");
-  if (eq == std::string::npos)
+  size_t eq = string.find('=');
+  if (eq == base::StringPiece::npos)
     return false;
   size_t vstart = eq + 1;
 
   // If we're at the end of the string, value is empt.
   if (vstart == string.size()) {
-    *key = string.substr(0, eq);
+    *key = std::string(string.substr(0, eq));
     *value = "";
     *end = string.size();
     return true;
@@ -1177,7 +1308,7 @@ bool TorControl::ParseKV(const std::string& string,
   if (string[vstart] != '"') {
     // Not quoted.  Check for a delimiter.
     size_t i, vend = string.size();
-    if ((i = string.find(" ", vstart)) != std::string::npos) {
+    if ((i = string.find(' ', vstart)) != base::StringPiece::npos) {
       // Delimited.  Stop at the delimiter, and consume it.
       vend = i;
       *end = vend + 1;
@@ -1187,19 +1318,19 @@ bool TorControl::ParseKV(const std::string& string,
     }
 
     // Check for internal quotes; they are forbidden.
-    if (string.find("\"", vstart) != std::string::npos)
+    if (string.find('"', vstart) != base::StringPiece::npos)
       return false;
 
     // Extract the key and value and we're done.
-    *key = string.substr(0, eq);
-    *value = string.substr(vstart, vend - vstart);
+    *key = std::string(string.substr(0, eq));
+    *value = std::string(string.substr(vstart, vend - vstart));
     return true;
   }
 
   // Quoted string.  Parse it, and consume trailing spaces.
   if (!ParseQuoted(string.substr(eq + 1), value, end))
     return false;
-  *key = string.substr(0, eq);
+  *key = std::string(string.substr(0, eq));
   *end += eq + 1;
   while (*end < string.size() && string[*end] == ' ')
     (*end)++;
@@ -1214,7 +1345,7 @@ bool TorControl::ParseKV(const std::string& string,
 //      return false on failure.
 //
 // static
-bool TorControl::ParseQuoted(const std::string& string,
+bool TorControl::ParseQuoted(base::StringPiece string,
                              std::string* value,
                              size_t* end) {
   enum {
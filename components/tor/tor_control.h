@@ -18,7 +18,9 @@
 #include "base/gtest_prod_util.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/tor/tor_control_event.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace base {
 class SequencedTaskRunner;
@@ -105,16 +107,19 @@ class TorControl {
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseQuoted);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseKV);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadLine);
+  FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadDataReply);
+  FRIEND_TEST_ALL_PREFIXES(TorControlTest, CoalesceBandwidthEventsInOrder);
+  FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReplayTranscript);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, GetCircuitEstablishedDone);
 
-  static bool ParseKV(const std::string& string,
+  static bool ParseKV(base::StringPiece string,
                       std::string* key,
                       std::string* value);
-  static bool ParseKV(const std::string& string,
+  static bool ParseKV(base::StringPiece string,
                       std::string* key,
                       std::string* value,
                       size_t* end);
-  static bool ParseQuoted(const std::string& string,
+  static bool ParseQuoted(base::StringPiece string,
                           std::string* value,
                           size_t* end);
 
@@ -188,12 +193,15 @@ class TorControl {
   void NotifyTorControlClosed();
 
   void NotifyTorEvent(TorControlEvent,
-                      const std::string& initial,
+                      base::StringPiece initial,
                       const std::map<std::string, std::string>& extra);
+  struct PendingBandwidth;
+  PendingBandwidth& GetPendingBandwidth();
+  void FlushPendingBandwidth();
   void NotifyTorRawCmd(const std::string& cmd);
-  void NotifyTorRawAsync(const std::string& status, const std::string& line);
-  void NotifyTorRawMid(const std::string& status, const std::string& line);
-  void NotifyTorRawEnd(const std::string& status, const std::string& line);
+  void NotifyTorRawAsync(base::StringPiece status, base::StringPiece line);
+  void NotifyTorRawMid(base::StringPiece status, base::StringPiece line);
+  void NotifyTorRawEnd(base::StringPiece status, base::StringPiece line);
 
   void StartWrite();
   void DoWrites();
@@ -204,7 +212,8 @@ class TorControl {
   void DoReads();
   void ReadDoneAsync(int rv);
   void ReadDone(int rv);
-  bool ReadLine(const std::string& line);
+  bool ReadLine(base::StringPiece line);
+  bool ReadDataLine(base::StringPiece line);
 
   void Error();
 
@@ -244,6 +253,35 @@ class TorControl {
   };
   std::unique_ptr<Async> async_;
 
+  // Data reply (`xyz+') state machine.
+  struct DataReply {
+    DataReply();
+    ~DataReply();
+    std::string status;
+    // The reply line that introduced the data, followed by the data lines,
+    // joined with LF.
+    std::string reply;
+    bool skip;
+  };
+  std::unique_ptr<DataReply> data_reply_;
+
+  // Latest bandwidth event and its raw line (see NotifyTorEvent) that
+  // haven't been posted to the delegate yet.
+  struct PendingBandwidth {
+    PendingBandwidth();
+    PendingBandwidth(PendingBandwidth&&);
+    PendingBandwidth& operator=(PendingBandwidth&&);
+    ~PendingBandwidth();
+    std::string raw_status;
+    std::string raw_line;
+    // Whether the raw line was also parsed into an event, which isn't the
+    // case when we aren't subscribed to BW.
+    bool has_event = false;
+    std::string initial;
+    std::map<std::string, std::string> extra;
+  };
+  absl::optional<PendingBandwidth> pending_bandwidth_;
+
   base::WeakPtr<TorControl::Delegate> delegate_;
 
   base::WeakPtrFactory<TorControl> weak_ptr_factory_{this};
@@ -3,12 +3,20 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "brave/components/tor/tor_control.h"
 
 #include "base/functional/callback_helpers.h"
 #include "base/run_loop.h"
+#include "base/strings/string_piece.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/test/bind.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
@@ -30,6 +38,32 @@ class MockTorControlDelegate : public TorControl::Delegate {
   MOCK_METHOD2(OnTorRawMid, void(const std::string&, const std::string&));
   MOCK_METHOD2(OnTorRawEnd, void(const std::string&, const std::string&));
 };
+
+// A control port session as read from tor: replies to two commands, one of
+// them a data reply, interleaved with events.  Some of the events are
+// multi-line, one is a data reply for an event we don't handle and the
+// bandwidth events arrive back to back.
+constexpr char kTranscript[] =
+    "250-version=0.4.7.13\r\n"
+    "250 OK\r\n"
+    "650 STATUS_CLIENT NOTICE BOOTSTRAP PROGRESS=10 TAG=conn_done "
+    "SUMMARY=\"Connected to a relay\"\r\n"
+    "650 BW 1024 2048\r\n"
+    "650 BW 10 20\r\n"
+    "650-CIRC 7 BUILT $AAAA~relay PURPOSE=GENERAL\r\n"
+    "650 TIME_CREATED=2023-01-01T00:00:00.000000\r\n"
+    "650+NS\r\n"
+    "r relay1 AAAA BBBB 2023-01-01 00:00:00 127.0.0.1 9001 0\r\n"
+    "..leading dot\r\n"
+    ".\r\n"
+    "650 OK\r\n"
+    "650 STREAM 12 SUCCEEDED 7 example.com:443\r\n"
+    "250+config-text=\r\n"
+    "SocksPort 9050\r\n"
+    "..leading dot\r\n"
+    ".\r\n"
+    "250 OK\r\n"
+    "650 NETWORK_LIVENESS UP\r\n";
 }  // namespace
 
 TEST(TorControlTest, ParseQuoted) {
@@ -302,4 +336,213 @@ TEST(TorControlTest, GetCircuitEstablishedDone) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST(TorControlTest, ReadDataReply) {
+  content::BrowserTaskEnvironment task_environment;
+  scoped_refptr<base::SequencedTaskRunner> io_task_runner =
+      content::GetIOThreadTaskRunner({});
+
+  testing::NiceMock<MockTorControlDelegate> delegate;
+  std::unique_ptr<TorControl> control =
+      std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+
+  EXPECT_CALL(delegate, OnTorControlClosed(testing::_)).Times(0);
+  EXPECT_CALL(delegate,
+              OnTorRawMid("250", "config-text=\nSocksPort 9050\n.Log x"))
+      .Times(1);
+  EXPECT_CALL(delegate,
+              OnTorEvent(TorControlEvent::NETWORK_LIVENESS, "UP", testing::_))
+      .Times(1);
+  io_task_runner->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](std::unique_ptr<TorControl> control) {
+            std::vector<std::string> lines;
+            bool done = false;
+            control->cmdq_.emplace(
+                base::BindLambdaForTesting(
+                    [&](const std::string& status, const std::string& reply) {
+                      lines.push_back(status + " " + reply);
+                    }),
+                base::BindLambdaForTesting([&](bool error,
+                                               const std::string& status,
+                                               const std::string& reply) {
+                  EXPECT_FALSE(error);
+                  EXPECT_EQ("OK", reply);
+                  done = true;
+                }));
+            EXPECT_TRUE(control->ReadLine("250+config-text="));
+            // Data lines don't have a status and may be short.
+            EXPECT_TRUE(control->ReadLine("SocksPort 9050"));
+            EXPECT_TRUE(control->ReadLine("..Log x"));
+            EXPECT_TRUE(control->ReadLine("."));
+            EXPECT_FALSE(control->data_reply_);
+            EXPECT_TRUE(control->ReadLine("250 OK"));
+            EXPECT_TRUE(done);
+            EXPECT_EQ(std::vector<std::string>(
+                          {"250 config-text=\nSocksPort 9050\n.Log x"}),
+                      lines);
+
+            // Async data replies are skipped up to the end of the reply.
+            control->async_events_[TorControlEvent::NETWORK_LIVENESS] = 1;
+            EXPECT_TRUE(control->ReadLine("650+NS"));
+            EXPECT_TRUE(control->ReadLine("r"));
+            EXPECT_TRUE(control->ReadLine("650 NETWORK_LIVENESS DOWN"));
+            EXPECT_TRUE(control->ReadLine("."));
+            EXPECT_TRUE(control->ReadLine("650 OK"));
+            EXPECT_FALSE(control->async_);
+            EXPECT_TRUE(control->ReadLine("650 NETWORK_LIVENESS UP"));
+          },
+          std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+}
+
+TEST(TorControlTest, CoalesceBandwidthEventsInOrder) {
+  content::BrowserTaskEnvironment task_environment;
+  scoped_refptr<base::SequencedTaskRunner> io_task_runner =
+      content::GetIOThreadTaskRunner({});
+
+  testing::StrictMock<MockTorControlDelegate> delegate;
+  std::unique_ptr<TorControl> control =
+      std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+
+  // Only the last bandwidth event before another notification is posted,
+  // raw line and all, and it is posted before that notification.
+  {
+    testing::InSequence s;
+    EXPECT_CALL(delegate, OnTorRawAsync("650", "BW 3 4"));
+    EXPECT_CALL(delegate,
+                OnTorEvent(TorControlEvent::BW, "3 4", testing::IsEmpty()));
+    EXPECT_CALL(delegate, OnTorRawAsync("650", "NETWORK_LIVENESS UP"));
+    EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::NETWORK_LIVENESS, "UP",
+                                     testing::IsEmpty()));
+    EXPECT_CALL(delegate, OnTorRawAsync("650", "BW 5 6"));
+    EXPECT_CALL(delegate, OnTorRawEnd("250", "OK"));
+    EXPECT_CALL(delegate, OnTorRawAsync("650", "BW 7 8"));
+    EXPECT_CALL(delegate,
+                OnTorEvent(TorControlEvent::BW, "7 8", testing::IsEmpty()));
+  }
+  io_task_runner->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](std::unique_ptr<TorControl> control) {
+            control->async_events_[TorControlEvent::NETWORK_LIVENESS] = 1;
+            control->async_events_[TorControlEvent::BW] = 1;
+            EXPECT_TRUE(control->ReadLine("650 BW 1 2"));
+            EXPECT_TRUE(control->ReadLine("650 BW 3 4"));
+            EXPECT_TRUE(control->ReadLine("650 NETWORK_LIVENESS UP"));
+
+            // Without a subscription only the raw line is held back.
+            control->async_events_.erase(TorControlEvent::BW);
+            EXPECT_TRUE(control->ReadLine("650 BW 5 6"));
+            EXPECT_TRUE(control->ReadLine("250 OK"));
+
+            control->async_events_[TorControlEvent::BW] = 1;
+            EXPECT_TRUE(control->ReadLine("650 BW 7 8"));
+            // Keep |control| alive until the pending event is posted.
+            base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(
+                FROM_HERE, std::move(control));
+          },
+          std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+}
+
+TEST(TorControlTest, ReplayTranscript) {
+  content::BrowserTaskEnvironment task_environment;
+  scoped_refptr<base::SequencedTaskRunner> io_task_runner =
+      content::GetIOThreadTaskRunner({});
+
+  const size_t kChunkSizes[] = {1, 3, 16, 4096};
+  const int kRuns = std::size(kChunkSizes);
+
+  testing::NiceMock<MockTorControlDelegate> delegate;
+  EXPECT_CALL(delegate, OnTorControlClosed(testing::_)).Times(0);
+  EXPECT_CALL(delegate,
+              OnTorEvent(TorControlEvent::STATUS_CLIENT,
+                         "NOTICE BOOTSTRAP PROGRESS=10 TAG=conn_done "
+                         "SUMMARY=\"Connected to a relay\"",
+                         testing::IsEmpty()))
+      .Times(kRuns);
+  // Back to back bandwidth events are coalesced into the latest one.
+  EXPECT_CALL(delegate,
+              OnTorEvent(TorControlEvent::BW, "10 20", testing::IsEmpty()))
+      .Times(kRuns);
+  std::map<std::string, std::string> circ_extra = {
+      {"TIME_CREATED", "2023-01-01T00:00:00.000000"}};
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::CIRC,
+                                   "7 BUILT $AAAA~relay PURPOSE=GENERAL",
+                                   circ_extra))
+      .Times(kRuns);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::STREAM,
+                                   "12 SUCCEEDED 7 example.com:443",
+                                   testing::IsEmpty()))
+      .Times(kRuns);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::NETWORK_LIVENESS, "UP",
+                                   testing::IsEmpty()))
+      .Times(kRuns);
+
+  for (size_t chunk_size : kChunkSizes) {
+    std::unique_ptr<TorControl> control =
+        std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+    io_task_runner->PostTask(
+        FROM_HERE,
+        base::BindOnce(
+            [](size_t chunk_size, std::unique_ptr<TorControl> control) {
+              SCOPED_TRACE(chunk_size);
+              std::vector<std::string> lines;
+              int done = 0;
+              for (int i = 0; i < 2; ++i) {
+                control->cmdq_.emplace(
+                    base::BindLambdaForTesting([&](const std::string& status,
+                                                   const std::string& reply) {
+                      lines.push_back(status + " " + reply);
+                    }),
+                    base::BindLambdaForTesting(
+                        [&](bool error, const std::string& status,
+                            const std::string& reply) {
+                          EXPECT_FALSE(error);
+                          EXPECT_EQ("250", status);
+                          EXPECT_EQ("OK", reply);
+                          done++;
+                        }));
+              }
+              for (auto event :
+                   {TorControlEvent::STATUS_CLIENT, TorControlEvent::BW,
+                    TorControlEvent::CIRC, TorControlEvent::STREAM,
+                    TorControlEvent::NETWORK_LIVENESS}) {
+                control->async_events_[event] = 1;
+              }
+              control->reading_ = true;
+              control->StartRead();
+
+              // Feed the transcript through the read path |chunk_size|
+              // bytes at a time, as if it came from the socket.
+              base::StringPiece data = kTranscript;
+              while (!data.empty()) {
+                const size_t size = std::min(
+                    {chunk_size, data.size(),
+                     static_cast<size_t>(
+                         control->readiobuf_->RemainingCapacity())});
+                std::copy_n(data.data(), size, control->readiobuf_->data());
+                control->ReadDone(static_cast<int>(size));
+                data.remove_prefix(size);
+              }
+
+              EXPECT_TRUE(control->reading_);
+              EXPECT_EQ(2, done);
+              EXPECT_EQ(std::vector<std::string>(
+                            {"250 version=0.4.7.13",
+                             "250 config-text=\nSocksPort 9050\n.leading dot"}),
+                        lines);
+              // Keep |control| alive until the coalesced events are posted.
+              base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(
+                  FROM_HERE, std::move(control));
+            },
+            chunk_size, std::move(control)));
+  }
+
+  base::RunLoop().RunUntilIdle();
+}
+
 }  // namespace tor
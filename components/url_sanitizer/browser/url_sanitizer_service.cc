@@ -6,10 +6,12 @@
 #include "brave/components/url_sanitizer/browser/url_sanitizer_service.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base/json/json_reader.h"
 #include "base/logging.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
@@ -49,8 +51,32 @@ absl::optional<base::flat_set<std::string>> CreateParamsList(
   return result;
 }
 
-base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
-    const std::string& json) {
+void AddToIndex(const extensions::URLPatternSet& include,
+                size_t item_index,
+                URLSanitizerService::Matchers* matchers) {
+  bool any_host = false;
+  std::vector<std::string> hosts;
+  for (const URLPattern& pattern : include) {
+    if (pattern.match_all_urls() || pattern.host().empty()) {
+      any_host = true;
+      break;
+    }
+    hosts.push_back(base::ToLowerASCII(pattern.host()));
+  }
+  if (any_host) {
+    matchers->any_host_items.push_back(item_index);
+    return;
+  }
+  for (auto& host : hosts) {
+    auto& indices = matchers->host_index[std::move(host)];
+    // Several patterns of one item may share a host.
+    if (indices.empty() || indices.back() != item_index) {
+      indices.push_back(item_index);
+    }
+  }
+}
+
+URLSanitizerService::Matchers ParseFromJson(const std::string& json) {
   auto parsed_json = base::JSONReader::ReadAndReturnValueWithError(json);
   if (!parsed_json.has_value()) {
     VLOG(1) << "Error parsing feature JSON: " << parsed_json.error().message;
@@ -60,7 +86,7 @@ base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
   if (!list) {
     return {};
   }
-  base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers;
+  URLSanitizerService::Matchers matchers;
   for (const auto& it : *list) {
     const base::Value::Dict* items = it.GetIfDict();
     if (!items)
@@ -85,7 +111,8 @@ base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
         std::move(include_matcher), std::move(exclude_matcher),
         std::move(*params));
 
-    matchers.insert(std::move(item));
+    AddToIndex(item->include, matchers.items.size(), &matchers);
+    matchers.items.push_back(std::move(item));
   }
 
   return matchers;
@@ -105,6 +132,12 @@ URLSanitizerService::MatchItem::MatchItem(extensions::URLPatternSet in,
                                           base::flat_set<std::string> prm)
     : include(std::move(in)), exclude(std::move(ex)), params(std::move(prm)) {}
 
+URLSanitizerService::Matchers::Matchers() = default;
+URLSanitizerService::Matchers::Matchers(Matchers&&) = default;
+URLSanitizerService::Matchers& URLSanitizerService::Matchers::operator=(
+    Matchers&&) = default;
+URLSanitizerService::Matchers::~Matchers() = default;
+
 void URLSanitizerService::Initialize(const std::string& json) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()}, base::BindOnce(&ParseFromJson, json),
@@ -112,18 +145,45 @@ void URLSanitizerService::Initialize(const std::string& json) {
                      weak_factory_.GetWeakPtr()));
 }
 
-void URLSanitizerService::UpdateMatchers(
-    base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> mappings) {
-  matchers_ = std::move(mappings);
+void URLSanitizerService::UpdateMatchers(Matchers matchers) {
+  matchers_ = std::move(matchers);
   if (initialization_callback_for_testing_)
     std::move(initialization_callback_for_testing_).Run();
 }
 
+std::vector<size_t> URLSanitizerService::GetCandidates(
+    base::StringPiece host) const {
+  std::vector<size_t> candidates = matchers_.any_host_items;
+  // URLPattern ignores the trailing dot of a fully qualified host, so the
+  // index must too.
+  if (base::EndsWith(host, ".")) {
+    host.remove_suffix(1);
+  }
+  // Look up the host and each of its parent domains.
+  while (!host.empty()) {
+    const auto it = matchers_.host_index.find(host);
+    if (it != matchers_.host_index.end()) {
+      candidates.insert(candidates.end(), it->second.begin(),
+                        it->second.end());
+    }
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos) {
+      break;
+    }
+    host.remove_prefix(dot + 1);
+  }
+  // Keep the order the items were listed in.
+  base::ranges::sort(candidates);
+  candidates.erase(base::ranges::unique(candidates), candidates.end());
+  return candidates;
+}
+
 GURL URLSanitizerService::SanitizeURL(const GURL& initial_url) {
-  if (matchers_.empty() || !initial_url.SchemeIsHTTPOrHTTPS())
+  if (matchers_.items.empty() || !initial_url.SchemeIsHTTPOrHTTPS())
     return initial_url;
   GURL url = initial_url;
-  for (const auto& it : matchers_) {
+  for (size_t index : GetCandidates(initial_url.host_piece())) {
+    const auto& it = matchers_.items[index];
     if (!it->include.MatchesURL(url) || it->exclude.MatchesURL(url))
       continue;
     auto sanitized_query = StripQueryParameter(url.query(), it->params);
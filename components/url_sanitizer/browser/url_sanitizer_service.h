@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
@@ -41,6 +42,23 @@ class URLSanitizerService : public KeyedService,
     base::flat_set<std::string> params;
   };
 
+  // The match items along with an index of their include patterns by host, so
+  // a URL is only tested against the items that can apply to it.
+  struct Matchers {
+    Matchers();
+    Matchers(Matchers&&);
+    Matchers& operator=(Matchers&&);
+    ~Matchers();
+
+    std::vector<std::unique_ptr<MatchItem>> items;
+    // Indices into |items| keyed by the host of their include patterns.
+    // Subdomain patterns are keyed by their base host and found by walking up
+    // the labels of the URL host.
+    base::flat_map<std::string, std::vector<size_t>> host_index;
+    // Items with an include pattern that applies to any host.
+    std::vector<size_t> any_host_items;
+  };
+
   GURL SanitizeURL(const GURL& url);
 
   void SetInitializationCallbackForTesting(base::OnceClosure callback) {
@@ -52,14 +70,16 @@ class URLSanitizerService : public KeyedService,
  protected:
   friend class URLSanitizerServiceUnitTest;
 
-  void UpdateMatchers(
-      base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>>);
+  void UpdateMatchers(Matchers matchers);
 
   std::string StripQueryParameter(const std::string& query,
                                   const base::flat_set<std::string>& trackers);
 
+  // Indices of the items that can match a URL on |host|, in |items| order.
+  std::vector<size_t> GetCandidates(base::StringPiece host) const;
+
  private:
-  base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers_;
+  Matchers matchers_;
   base::OnceClosure initialization_callback_for_testing_;
   base::WeakPtrFactory<URLSanitizerService> weak_factory_{this};
 };
@@ -154,4 +154,35 @@ TEST_F(URLSanitizerServiceUnitTest, ClearURLS) {
             GURL("ws://localhost:8080/?utm_source=web"));
 }
 
+TEST_F(URLSanitizerServiceUnitTest, HostIndex) {
+  WaitInitialization(R"([
+    { "include": [ "*://*.example.com/*"], "params": ["a"] },
+    { "include": [ "https://exact.org/*", "https://*.sub.exact.org/*" ],
+      "params": ["b"] },
+    { "include": [ "*://*/*"], "exclude": [ "*://*.example.com/*" ],
+      "params": ["c"] }
+  ])");
+
+  EXPECT_EQ(std::vector<size_t>({0u, 2u}), GetCandidates("example.com"));
+  EXPECT_EQ(std::vector<size_t>({0u, 2u}), GetCandidates("a.b.example.com"));
+  EXPECT_EQ(std::vector<size_t>({1u, 2u}), GetCandidates("exact.org"));
+  EXPECT_EQ(std::vector<size_t>({1u, 2u}), GetCandidates("x.sub.exact.org"));
+  EXPECT_EQ(std::vector<size_t>({2u}), GetCandidates("brave.com"));
+  EXPECT_EQ(std::vector<size_t>({0u, 2u}), GetCandidates("a.example.com."));
+  EXPECT_EQ(std::vector<size_t>({1u, 2u}), GetCandidates("exact.org."));
+
+  EXPECT_EQ(SanitizeURL(GURL("https://a.b.example.com/?a=1&b=2&c=3")),
+            GURL("https://a.b.example.com/?b=2&c=3"));
+  EXPECT_EQ(SanitizeURL(GURL("https://exact.org/?a=1&b=2&c=3")),
+            GURL("https://exact.org/?a=1"));
+  // Only the subdomain pattern of the second item covers subdomains.
+  EXPECT_EQ(SanitizeURL(GURL("https://www.exact.org/?a=1&b=2&c=3")),
+            GURL("https://www.exact.org/?a=1&b=2"));
+  EXPECT_EQ(SanitizeURL(GURL("https://x.sub.exact.org/?a=1&b=2&c=3")),
+            GURL("https://x.sub.exact.org/?a=1"));
+  // Fully qualified hosts match the same rules.
+  EXPECT_EQ(SanitizeURL(GURL("https://a.b.example.com./?a=1&b=2&c=3")),
+            GURL("https://a.b.example.com./?b=2&c=3"));
+}
+
 }  // namespace brave
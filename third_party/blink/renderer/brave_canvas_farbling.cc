@@ -0,0 +1,122 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/brave_canvas_farbling.h"
+
+#include <string.h>
+
+#include "base/check.h"
+#include "base/hash/hash.h"
+#include "base/strings/string_piece.h"
+#include "crypto/hmac.h"
+#include "third_party/boringssl/src/include/openssl/siphash.h"
+
+namespace brave {
+
+namespace {
+
+constexpr uint64_t zero = 0;
+
+inline uint64_t lfsr_next(uint64_t v) {
+  return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+}
+
+}  // namespace
+
+CanvasFarblingHelper::CanvasFarblingHelper(uint64_t key, HashType hash_type)
+    : key_(key), hash_type_(hash_type) {}
+
+CanvasFarblingHelper::~CanvasFarblingHelper() = default;
+
+void CanvasFarblingHelper::PerturbPixels(uint8_t* pixels, size_t size) {
+  if (!pixels || size == 0)
+    return;
+
+  // This needs to be type size_t because we pass it to base::StringPiece
+  // later for content hashing. This is safe because the maximum canvas
+  // dimensions are less than SIZE_T_MAX. (Width and height are each
+  // limited to 32,767 pixels.)
+  // Four bits per pixel
+  const size_t pixel_count = size / 4;
+  // calculate initial seed to find first pixel to perturb, based on session
+  // key, domain key, and canvas contents
+  const CanvasKey canvas_key = GetCanvasKey(base::make_span(pixels, size));
+  uint64_t v;
+  memcpy(&v, canvas_key.data(), sizeof v);
+  uint64_t pixel_index;
+  // choose which channel (R, G, or B) to perturb
+  uint8_t channel;
+  // iterate through 32-byte canvas key and use each bit to determine how to
+  // perturb the current pixel
+  for (int i = 0; i < 32; i++) {
+    uint8_t bit = canvas_key[i];
+    for (int j = 0; j < 16; j++) {
+      if (j % 8 == 0)
+        bit = canvas_key[i];
+      channel = v % 3;
+      pixel_index = 4 * (v % pixel_count) + channel;
+      pixels[pixel_index] = pixels[pixel_index] ^ (bit & 0x1);
+      bit = bit >> 1;
+      // find next pixel to perturb
+      v = lfsr_next(v);
+    }
+  }
+}
+
+CanvasFarblingHelper::CanvasKey CanvasFarblingHelper::GetCanvasKey(
+    base::span<const uint8_t> pixels) {
+  // The lookup hash has to cover every byte. If it only sampled the pixels,
+  // contents differing outside the samples would share a cache entry, and
+  // their farbling would depend on which one was read first instead of on
+  // the contents alone. An unkeyed FastHash pass is still much cheaper than
+  // the keyed hash it saves.
+  const size_t content_hash = base::FastHash(pixels);
+  for (size_t i = 0; i < cache_used_; ++i) {
+    const CacheEntry& entry = cache_[i];
+    if (entry.size == pixels.size() && entry.content_hash == content_hash)
+      return entry.canvas_key;
+  }
+
+  CacheEntry& entry = cache_[next_cache_slot_];
+  entry.size = pixels.size();
+  entry.content_hash = content_hash;
+  entry.canvas_key = ComputeCanvasKey(pixels);
+  next_cache_slot_ = (next_cache_slot_ + 1) % kCacheSize;
+  if (cache_used_ < kCacheSize)
+    ++cache_used_;
+  return entry.canvas_key;
+}
+
+CanvasFarblingHelper::CanvasKey CanvasFarblingHelper::ComputeCanvasKey(
+    base::span<const uint8_t> pixels) const {
+  CanvasKey canvas_key;
+  switch (hash_type_) {
+    case HashType::kHmacSha256: {
+      crypto::HMAC h(crypto::HMAC::SHA256);
+      CHECK(h.Init(reinterpret_cast<const unsigned char*>(&key_), sizeof key_));
+      CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(
+                                         pixels.data()),
+                                     pixels.size()),
+                   canvas_key.data(), canvas_key.size()));
+      break;
+    }
+    case HashType::kSipHash: {
+      const uint64_t sip_key[2] = {key_, lfsr_next(key_)};
+      // Hash the contents once, then expand the digest to the key size.
+      uint64_t block[2] = {SIPHASH_24(sip_key, pixels.data(), pixels.size()),
+                           0};
+      for (size_t i = 0; i < canvas_key.size() / sizeof(uint64_t); ++i) {
+        block[1] = i;
+        const uint64_t word = SIPHASH_24(
+            sip_key, reinterpret_cast<const uint8_t*>(block), sizeof block);
+        memcpy(canvas_key.data() + i * sizeof word, &word, sizeof word);
+      }
+      break;
+    }
+  }
+  return canvas_key;
+}
+
+}  // namespace brave
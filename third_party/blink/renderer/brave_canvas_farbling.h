@@ -0,0 +1,69 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_CANVAS_FARBLING_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_CANVAS_FARBLING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "base/containers/span.h"
+#include "third_party/blink/public/platform/web_common.h"
+
+namespace brave {
+
+// Perturbs canvas read-backs for one session and site. Which pixels get
+// flipped is derived from a keyed hash of the canvas contents, so the same
+// contents always come out the same way within a session.
+//
+// Fingerprinting scripts read back identical contents many times, so the keys
+// derived for the last few contents are kept and reused. They are looked up
+// by a fast unkeyed hash, which is much cheaper than the keyed one.
+class BLINK_EXPORT CanvasFarblingHelper {
+ public:
+  // The 32 bytes whose bits drive the pixel perturbation.
+  using CanvasKey = std::array<uint8_t, 32>;
+
+  enum class HashType {
+    // HMAC-SHA256, the historical derivation.
+    kHmacSha256,
+    // SipHash-2-4, faster but gives different keys than kHmacSha256.
+    kSipHash,
+  };
+
+  // |key| is the session key mixed with the domain key.
+  CanvasFarblingHelper(uint64_t key, HashType hash_type);
+  ~CanvasFarblingHelper();
+
+  CanvasFarblingHelper(const CanvasFarblingHelper&) = delete;
+  CanvasFarblingHelper& operator=(const CanvasFarblingHelper&) = delete;
+
+  void PerturbPixels(uint8_t* pixels, size_t size);
+
+  CanvasKey GetCanvasKey(base::span<const uint8_t> pixels);
+
+ private:
+  static constexpr size_t kCacheSize = 8;
+
+  struct CacheEntry {
+    size_t size = 0;
+    size_t content_hash = 0;
+    CanvasKey canvas_key = {};
+  };
+
+  CanvasKey ComputeCanvasKey(base::span<const uint8_t> pixels) const;
+
+  const uint64_t key_;
+  const HashType hash_type_;
+  std::array<CacheEntry, kCacheSize> cache_;
+  size_t cache_used_ = 0;
+  size_t next_cache_slot_ = 0;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_CANVAS_FARBLING_H_
@@ -0,0 +1,105 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/brave_canvas_farbling.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+namespace {
+
+constexpr uint64_t kKey = 0x0123456789abcdefULL;
+
+std::vector<uint8_t> MakeCanvas(size_t width, size_t height, uint8_t salt) {
+  std::vector<uint8_t> pixels(width * height * 4);
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    pixels[i] = static_cast<uint8_t>(i * 31 + salt);
+  }
+  return pixels;
+}
+
+class CanvasFarblingHelperTest
+    : public ::testing::TestWithParam<CanvasFarblingHelper::HashType> {};
+
+}  // namespace
+
+INSTANTIATE_TEST_SUITE_P(
+    ,
+    CanvasFarblingHelperTest,
+    ::testing::Values(CanvasFarblingHelper::HashType::kHmacSha256,
+                      CanvasFarblingHelper::HashType::kSipHash));
+
+TEST_P(CanvasFarblingHelperTest, CachedKeyMatchesUncached) {
+  CanvasFarblingHelper helper(kKey, GetParam());
+  std::vector<std::vector<uint8_t>> canvases;
+  for (uint8_t salt = 0; salt < 12; ++salt) {
+    canvases.push_back(MakeCanvas(16, 16, salt));
+  }
+
+  // Go around more times than the cache holds, so entries get evicted.
+  for (int round = 0; round < 3; ++round) {
+    for (const auto& canvas : canvases) {
+      CanvasFarblingHelper uncached(kKey, GetParam());
+      EXPECT_EQ(uncached.GetCanvasKey(canvas), helper.GetCanvasKey(canvas));
+    }
+  }
+}
+
+TEST_P(CanvasFarblingHelperTest, StableWithinSession) {
+  CanvasFarblingHelper helper(kKey, GetParam());
+  const auto original = MakeCanvas(256, 256, 0);
+
+  auto first = original;
+  helper.PerturbPixels(first.data(), first.size());
+  EXPECT_NE(original, first);
+  auto second = original;
+  helper.PerturbPixels(second.data(), second.size());
+  EXPECT_EQ(first, second);
+
+  // Other contents or another session farble differently.
+  EXPECT_NE(helper.GetCanvasKey(original),
+            helper.GetCanvasKey(MakeCanvas(256, 256, 1)));
+  CanvasFarblingHelper other_session(kKey + 1, GetParam());
+  EXPECT_NE(helper.GetCanvasKey(original),
+            other_session.GetCanvasKey(original));
+}
+
+TEST_P(CanvasFarblingHelperTest, EveryByteAffectsCachedKey) {
+  CanvasFarblingHelper helper(kKey, GetParam());
+  const auto original = MakeCanvas(64, 64, 0);
+  const CanvasFarblingHelper::CanvasKey original_key =
+      helper.GetCanvasKey(original);
+
+  // Changing any single byte must miss the cache and give the key an uncached
+  // helper would derive.
+  for (size_t i : {size_t{0}, size_t{1}, original.size() / 2 + 3,
+                   original.size() - 1}) {
+    auto changed = original;
+    changed[i] ^= 1;
+    CanvasFarblingHelper uncached(kKey, GetParam());
+    const CanvasFarblingHelper::CanvasKey changed_key =
+        helper.GetCanvasKey(changed);
+    EXPECT_NE(original_key, changed_key);
+    EXPECT_EQ(uncached.GetCanvasKey(changed), changed_key);
+  }
+}
+
+TEST(CanvasFarblingHelperUnitTest, HmacKeyIsUnchanged) {
+  // Keys derived with HMAC-SHA256 must stay as they were before caching was
+  // added, so sites see the same farbling as before.
+  CanvasFarblingHelper helper(kKey,
+                              CanvasFarblingHelper::HashType::kHmacSha256);
+  const std::vector<uint8_t> pixels = {1, 2, 3, 4, 5, 6, 7, 8};
+  const CanvasFarblingHelper::CanvasKey expected = {
+      0x1f, 0x69, 0x2e, 0xc6, 0xf9, 0x89, 0x55, 0x18, 0x93, 0x72, 0x73,
+      0x31, 0xd5, 0x0c, 0x1a, 0xb3, 0x52, 0x85, 0x74, 0x56, 0xdc, 0x4f,
+      0x97, 0xca, 0xa2, 0x24, 0x4e, 0x5b, 0x8f, 0xca, 0xa6, 0x88};
+  EXPECT_EQ(expected, helper.GetCanvasKey(pixels));
+}
+
+}  // namespace brave
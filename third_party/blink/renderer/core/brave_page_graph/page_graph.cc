@@ -81,6 +81,7 @@
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_sessionstorage.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_utils.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/tracked_request.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/scripts/script_tracker.h"
@@ -1007,22 +1008,24 @@ void PageGraph::GenerateReportForNode(const blink::DOMNodeId node_id,
 }
 
 String PageGraph::ToGraphML() const {
-  xmlDocPtr graphml_doc = xmlNewDoc(BAD_CAST "1.0");
-  xmlNodePtr graphml_root_node = xmlNewNode(nullptr, BAD_CAST "graphml");
-  xmlDocSetRootElement(graphml_doc, graphml_root_node);
-
-  xmlNewNs(graphml_root_node, BAD_CAST "http://graphml.graphdrawing.org/xmlns",
-           nullptr);
-  xmlNsPtr xsi_ns = xmlNewNs(
-      graphml_root_node, BAD_CAST "http://www.w3.org/2001/XMLSchema-instance",
-      BAD_CAST "xsi");
-  xmlNewNsProp(graphml_root_node, xsi_ns, BAD_CAST "schemaLocation",
-               BAD_CAST
-               "http://graphml.graphdrawing.org/xmlns "
-               "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd");
+  PageGraphWriter writer;
+  WriteGraph(writer);
+  String graphml_string = writer.Finish();
+  DCHECK(!graphml_string.empty());
+  return graphml_string;
+}
+
+void PageGraph::WriteGraph(PageGraphWriter& writer) const {
+  writer.StartElement(
+      "graphml",
+      {{"xmlns", "http://graphml.graphdrawing.org/xmlns"},
+       {"xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance"},
+       {"xsi:schemaLocation",
+        "http://graphml.graphdrawing.org/xmlns "
+        "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd"}});
 
   xmlNodePtr desc_container_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "desc", nullptr);
+      xmlNewChild(writer.scratch_node(), nullptr, BAD_CAST "desc", nullptr);
   xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "version",
                   BAD_CAST kPageGraphVersion);
   xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "about",
@@ -1048,31 +1051,22 @@ String PageGraph::ToGraphML() const {
       BAD_CAST base::NumberToString(end_time.InMilliseconds()).c_str());
 
   for (const auto& graphml_attr : brave_page_graph::GetGraphMLAttrs()) {
-    graphml_attr.second->AddDefinitionNode(graphml_root_node);
+    graphml_attr.second->AddDefinitionNode(writer.scratch_node());
   }
+  writer.WriteScratchNodes();
 
-  xmlNodePtr graph_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "graph", nullptr);
-  xmlSetProp(graph_node, BAD_CAST "id", BAD_CAST "G");
-  xmlSetProp(graph_node, BAD_CAST "edgedefault", BAD_CAST "directed");
-
+  // Nodes and edges are written one by one, so only a single item is held as
+  // a libxml tree at any time.
+  writer.StartElement("graph", {{"id", "G"}, {"edgedefault", "directed"}});
   for (const auto* node : nodes_) {
-    node->AddGraphMLTag(graphml_doc, graph_node);
+    writer.WriteItem(*node);
   }
   for (const auto* edge : edges_) {
-    edge->AddGraphMLTag(graphml_doc, graph_node);
+    writer.WriteItem(*edge);
   }
+  writer.EndElement();
 
-  xmlChar* xml_string;
-  int size;
-  xmlDocDumpMemoryEnc(graphml_doc, &xml_string, &size, "UTF-8");
-  auto graphml_string = String::FromUTF8(xml_string, size);
-  DCHECK(!graphml_string.empty());
-
-  xmlFree(xml_string);
-  xmlFree(graphml_doc);
-
-  return graphml_string;
+  writer.EndElement();
 }
 
 NodeHTML* PageGraph::GetHTMLNode(const DOMNodeId node_id) const {
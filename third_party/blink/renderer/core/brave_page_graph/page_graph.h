@@ -59,6 +59,7 @@ class NodeStorageSessionStorage;
 class NodeTrackerFilter;
 class NodeJSBuiltin;
 class NodeJSWebAPI;
+class PageGraphWriter;
 class RequestTracker;
 class ScriptTracker;
 struct TrackedRequestRecord;
@@ -269,6 +270,7 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   PAGE_GRAPH_USING_DECL(NodeStorageRoot);
   PAGE_GRAPH_USING_DECL(NodeStorageSessionStorage);
   PAGE_GRAPH_USING_DECL(NodeTrackerFilter);
+  PAGE_GRAPH_USING_DECL(PageGraphWriter);
   PAGE_GRAPH_USING_DECL(RequestTracker);
   PAGE_GRAPH_USING_DECL(RequestURL);
   PAGE_GRAPH_USING_DECL(ScriptData);
@@ -289,6 +291,8 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
     ScriptId parent_script_id = 0;
   };
 
+  void WriteGraph(PageGraphWriter& writer) const;
+
   NodeHTML* GetHTMLNode(const blink::DOMNodeId node_id) const;
   NodeHTMLElement* GetHTMLElementNode(const blink::DOMNodeId node_id) const;
   NodeHTMLText* GetHTMLTextNode(const blink::DOMNodeId node_id) const;
@@ -0,0 +1,75 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph_writer.h"
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item.h"
+
+namespace brave_page_graph {
+
+PageGraphWriter::PageGraphWriter()
+    : doc_(xmlNewDoc(BAD_CAST "1.0")),
+      scratch_node_(xmlNewNode(nullptr, BAD_CAST "scratch")),
+      buffer_(xmlBufferCreate()),
+      writer_(xmlNewTextWriterMemory(buffer_, 0)),
+      node_buffer_(xmlBufferCreate()),
+      node_save_ctxt_(
+          xmlSaveToBuffer(node_buffer_, "UTF-8", XML_SAVE_NO_DECL)) {
+  xmlDocSetRootElement(doc_, scratch_node_);
+  xmlTextWriterStartDocument(writer_, "1.0", "UTF-8", nullptr);
+}
+
+PageGraphWriter::~PageGraphWriter() {
+  xmlSaveClose(node_save_ctxt_);
+  xmlBufferFree(node_buffer_);
+  xmlFreeTextWriter(writer_);
+  xmlBufferFree(buffer_);
+  xmlFreeDoc(doc_);
+}
+
+void PageGraphWriter::StartElement(const char* name, Attributes attributes) {
+  xmlTextWriterStartElement(writer_, BAD_CAST name);
+  for (const auto& [attribute_name, value] : attributes) {
+    xmlTextWriterWriteAttribute(writer_, BAD_CAST attribute_name,
+                                BAD_CAST value);
+  }
+}
+
+void PageGraphWriter::EndElement() {
+  xmlTextWriterEndElement(writer_);
+}
+
+void PageGraphWriter::WriteScratchNodes() {
+  xmlNodePtr node = scratch_node_->children;
+  while (node) {
+    xmlNodePtr next = node->next;
+    WriteNode(node);
+    xmlUnlinkNode(node);
+    xmlFreeNode(node);
+    node = next;
+  }
+}
+
+void PageGraphWriter::WriteItem(const GraphItem& item) {
+  item.AddGraphMLTag(doc_, scratch_node_);
+  WriteScratchNodes();
+}
+
+String PageGraphWriter::Finish() {
+  xmlTextWriterEndDocument(writer_);
+  xmlTextWriterFlush(writer_);
+  return String::FromUTF8(xmlBufferContent(buffer_),
+                          xmlBufferLength(buffer_));
+}
+
+void PageGraphWriter::WriteNode(xmlNodePtr node) {
+  xmlSaveTree(node_save_ctxt_, node);
+  xmlSaveFlush(node_save_ctxt_);
+  xmlTextWriterWriteRawLen(writer_, xmlBufferContent(node_buffer_),
+                           xmlBufferLength(node_buffer_));
+  xmlBufferEmpty(node_buffer_);
+}
+
+}  // namespace brave_page_graph
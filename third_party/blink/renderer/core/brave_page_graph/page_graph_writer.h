@@ -0,0 +1,67 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_PAGE_GRAPH_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_PAGE_GRAPH_WRITER_H_
+
+#include <libxml/tree.h>
+#include <libxml/xmlsave.h>
+#include <libxml/xmlwriter.h>
+
+#include <initializer_list>
+#include <utility>
+
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+
+namespace brave_page_graph {
+
+class GraphItem;
+
+// Serializes a page graph to GraphML one element at a time. Graph items still
+// describe themselves through AddGraphMLTag(), but into a scratch document that
+// is written out and freed right away, so the full graph never exists as a
+// libxml tree.
+class PageGraphWriter {
+ public:
+  using Attributes =
+      std::initializer_list<std::pair<const char*, const char*>>;
+
+  PageGraphWriter();
+  ~PageGraphWriter();
+
+  PageGraphWriter(const PageGraphWriter&) = delete;
+  PageGraphWriter& operator=(const PageGraphWriter&) = delete;
+
+  // Opens an element that the following writes are nested in.
+  void StartElement(const char* name, Attributes attributes);
+  void EndElement();
+
+  // Scratch document and parent node to build elements in. Elements added to
+  // |scratch_node()| are written by WriteScratchNodes().
+  xmlDocPtr doc() const { return doc_; }
+  xmlNodePtr scratch_node() const { return scratch_node_; }
+  void WriteScratchNodes();
+
+  void WriteItem(const GraphItem& item);
+
+  // Closes the document and returns the GraphML written so far.
+  String Finish();
+
+ private:
+  // Writes |node| and its subtree.
+  void WriteNode(xmlNodePtr node);
+
+  xmlDocPtr doc_;
+  xmlNodePtr scratch_node_;
+  xmlBufferPtr buffer_;
+  xmlTextWriterPtr writer_;
+  // Receives one serialized element at a time.
+  xmlBufferPtr node_buffer_;
+  xmlSaveCtxtPtr node_save_ctxt_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_PAGE_GRAPH_WRITER_H_
@@ -238,50 +238,15 @@ void BraveSessionCache::FarbleAudioChannel(float* dst, size_t count) {
 void BraveSessionCache::PerturbPixels(const unsigned char* data, size_t size) {
   if (!farbling_enabled_ || farbling_level_ == BraveFarblingLevel::OFF)
     return;
-  PerturbPixelsInternal(data, size);
-}
-
-void BraveSessionCache::PerturbPixelsInternal(const unsigned char* data,
-                                              size_t size) {
-  if (!data || size == 0)
-    return;
-
-  uint8_t* pixels = const_cast<uint8_t*>(data);
-  // This needs to be type size_t because we pass it to base::StringPiece
-  // later for content hashing. This is safe because the maximum canvas
-  // dimensions are less than SIZE_T_MAX. (Width and height are each
-  // limited to 32,767 pixels.)
-  // Four bits per pixel
-  const size_t pixel_count = size / 4;
-  // calculate initial seed to find first pixel to perturb, based on session
-  // key, domain key, and canvas contents
-  crypto::HMAC h(crypto::HMAC::SHA256);
-  uint64_t session_plus_domain_key =
-      session_key_ ^ *reinterpret_cast<uint64_t*>(domain_key_);
-  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_plus_domain_key),
-               sizeof session_plus_domain_key));
-  uint8_t canvas_key[32];
-  CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(pixels), size),
-               canvas_key, sizeof canvas_key));
-  uint64_t v = *reinterpret_cast<uint64_t*>(canvas_key);
-  uint64_t pixel_index;
-  // choose which channel (R, G, or B) to perturb
-  uint8_t channel;
-  // iterate through 32-byte canvas key and use each bit to determine how to
-  // perturb the current pixel
-  for (int i = 0; i < 32; i++) {
-    uint8_t bit = canvas_key[i];
-    for (int j = 0; j < 16; j++) {
-      if (j % 8 == 0)
-        bit = canvas_key[i];
-      channel = v % 3;
-      pixel_index = 4 * (v % pixel_count) + channel;
-      pixels[pixel_index] = pixels[pixel_index] ^ (bit & 0x1);
-      bit = bit >> 1;
-      // find next pixel to perturb
-      v = lfsr_next(v);
-    }
+  if (!canvas_farbling_helper_) {
+    canvas_farbling_helper_.emplace(
+        session_key_ ^ *reinterpret_cast<uint64_t*>(domain_key_),
+        base::FeatureList::IsEnabled(
+            blink::features::kBraveCanvasFarblingSipHash)
+            ? CanvasFarblingHelper::HashType::kSipHash
+            : CanvasFarblingHelper::HashType::kHmacSha256);
   }
+  canvas_farbling_helper_->PerturbPixels(const_cast<uint8_t*>(data), size);
 }
 
 WTF::String BraveSessionCache::GenerateRandomString(std::string seed,
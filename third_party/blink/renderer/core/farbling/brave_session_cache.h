@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "brave/third_party/blink/renderer/brave_canvas_farbling.h"
 #include "brave/third_party/blink/renderer/brave_farbling_constants.h"
 #include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
 #include "third_party/abseil-cpp/absl/random/random.h"
@@ -98,8 +99,7 @@ class CORE_EXPORT BraveSessionCache final
   WTF::HashMap<FarbleKey, int> farbled_integers_;
   BraveFarblingLevel farbling_level_;
   absl::optional<blink::BraveAudioFarblingHelper> audio_farbling_helper_;
-
-  void PerturbPixelsInternal(const unsigned char* data, size_t size);
+  absl::optional<CanvasFarblingHelper> canvas_farbling_helper_;
 };
 
 }  // namespace brave
@@ -7,6 +7,8 @@
 
 #include <limits.h>
 
+#include <algorithm>
+
 #include "third_party/blink/renderer/platform/audio/audio_utilities.h"
 
 namespace blink {
@@ -15,27 +17,101 @@ namespace {
 constexpr uint64_t zero = 0;
 constexpr double maxUInt64AsDouble = static_cast<double>(UINT64_MAX);
 
+// Covers the largest AnalyserNode FFT size.
+constexpr size_t kMaxCachedValues = 32768;
+
 inline uint64_t lfsr_next(uint64_t v) {
   return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
 }
 
+inline float lfsr_value(uint64_t v) {
+  return (v / maxUInt64AsDouble) / 10;
+}
+
+// Calls |fn| with the |len| values of |input_buffer| that end at
+// |write_index|, wrapping around at |input_buffer_size|. Splitting the reads
+// into contiguous runs avoids a modulo per sample and lets the loops
+// vectorize.
+template <typename Fn>
+void ForEachTimeDomainValue(const float* input_buffer,
+                            size_t len,
+                            unsigned write_index,
+                            unsigned fft_size,
+                            unsigned input_buffer_size,
+                            Fn fn) {
+  size_t start = (static_cast<size_t>(write_index) + input_buffer_size -
+                  fft_size) %
+                 input_buffer_size;
+  size_t i = 0;
+  while (i < len) {
+    const size_t run = std::min(len - i, input_buffer_size - start);
+    const float* src = input_buffer + start;
+    for (size_t j = 0; j < run; ++j) {
+      fn(i + j, src[j]);
+    }
+    i += run;
+    start = 0;
+  }
+}
+
+inline unsigned char ClipToByte(double scaled_value) {
+  // Clip to valid range.
+  if (scaled_value < 0) {
+    scaled_value = 0;
+  }
+  if (scaled_value > UCHAR_MAX) {
+    scaled_value = UCHAR_MAX;
+  }
+  return static_cast<unsigned char>(scaled_value);
+}
+
 }  // namespace
 
 BraveAudioFarblingHelper::BraveAudioFarblingHelper(double fudge_factor,
                                                    uint64_t seed,
                                                    bool max)
-    : fudge_factor_(fudge_factor), seed_(seed), max_(max) {}
+    : fudge_factor_(fudge_factor),
+      seed_(seed),
+      max_(max),
+      max_values_state_(seed) {}
 
 BraveAudioFarblingHelper::~BraveAudioFarblingHelper() = default;
 
+void BraveAudioFarblingHelper::EnsureMaxValues(size_t count) const {
+  const size_t target = std::min(count, kMaxCachedValues);
+  if (max_values_.size() >= target) {
+    return;
+  }
+  max_values_.reserve(target);
+  uint64_t v = max_values_state_;
+  while (max_values_.size() < target) {
+    v = lfsr_next(v);
+    max_values_.push_back(lfsr_value(v));
+  }
+  max_values_state_ = v;
+}
+
+template <typename Fn>
+void BraveAudioFarblingHelper::ForEachMaxValue(size_t len, Fn fn) const {
+  EnsureMaxValues(len);
+  const size_t cached = std::min(len, max_values_.size());
+  const float* values = max_values_.data();
+  for (size_t i = 0; i < cached; ++i) {
+    fn(i, values[i]);
+  }
+  // Only reached when the cache is full, so |max_values_state_| is the state
+  // after |cached| steps.
+  uint64_t v = max_values_state_;
+  for (size_t i = cached; i < len; ++i) {
+    v = lfsr_next(v);
+    fn(i, lfsr_value(v));
+  }
+}
+
 void BraveAudioFarblingHelper::FarbleAudioChannel(float* dst,
                                                   size_t count) const {
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < count; i++) {
-      v = lfsr_next(v);
-      dst[i] = (v / maxUInt64AsDouble) / 10;
-    }
+    ForEachMaxValue(count, [dst](size_t i, float value) { dst[i] = value; });
   } else {
     for (size_t i = 0; i < count; i++) {
       dst[i] = dst[i] * fudge_factor_;
@@ -52,22 +128,17 @@ void BraveAudioFarblingHelper::FarbleFloatTimeDomainData(
     unsigned fft_size,
     unsigned input_buffer_size) const {
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float value = (v / maxUInt64AsDouble) / 10;
+    ForEachMaxValue(len, [destination](size_t i, float value) {
       destination[i] = value;
-    }
+    });
   } else {
-    for (size_t i = 0; i < len; ++i) {
-      // Buffer access is protected due to modulo operation.
-      float value =
-          fudge_factor_ *
-          input_buffer[(i + write_index - fft_size + input_buffer_size) %
-                       input_buffer_size];
-
-      destination[i] = value;
-    }
+    const double fudge_factor = fudge_factor_;
+    ForEachTimeDomainValue(
+        input_buffer, len, write_index, fft_size, input_buffer_size,
+        [destination, fudge_factor](size_t i, float input) {
+          float value = fudge_factor * input;
+          destination[i] = value;
+        });
   }
 }
 
@@ -79,46 +150,20 @@ void BraveAudioFarblingHelper::FarbleByteTimeDomainData(
     unsigned write_index,
     unsigned fft_size,
     unsigned input_buffer_size) const {
+  // Scale from nominal -1 -> +1 to unsigned byte.
+  auto write_byte = [destination](size_t i, float value) {
+    destination[i] = ClipToByte(128 * (value + 1));
+  };
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float value = (v / maxUInt64AsDouble) / 10;
-
-      // Scale from nominal -1 -> +1 to unsigned byte.
-      double scaled_value = 128 * (value + 1);
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
-    }
+    ForEachMaxValue(len, write_byte);
   } else {
-    for (size_t i = 0; i < len; ++i) {
-      // Buffer access is protected due to modulo operation.
-      float value =
-          fudge_factor_ *
-          input_buffer[(i + write_index - fft_size + input_buffer_size) %
-                       input_buffer_size];
-
-      // Scale from nominal -1 -> +1 to unsigned byte.
-      double scaled_value = 128 * (value + 1);
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
-    }
+    const double fudge_factor = fudge_factor_;
+    ForEachTimeDomainValue(input_buffer, len, write_index, fft_size,
+                           input_buffer_size,
+                           [&write_byte, fudge_factor](size_t i, float input) {
+                             float value = fudge_factor * input;
+                             write_byte(i, value);
+                           });
   }
 }
 
@@ -129,47 +174,21 @@ void BraveAudioFarblingHelper::FarbleConvertToByteData(
     size_t len,
     double min_decibels,
     double range_scale_factor) const {
+  auto write_byte = [destination, min_decibels, range_scale_factor](
+                        size_t i, float linear_value) {
+    double db_mag = audio_utilities::LinearToDecibels(linear_value);
+
+    // The range m_minDecibels to m_maxDecibels will be scaled to byte values
+    // from 0 to UCHAR_MAX.
+    destination[i] =
+        ClipToByte(UCHAR_MAX * (db_mag - min_decibels) * range_scale_factor);
+  };
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float linear_value = (v / maxUInt64AsDouble) / 10;
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-
-      // The range m_minDecibels to m_maxDecibels will be scaled to byte values
-      // from 0 to UCHAR_MAX.
-      double scaled_value =
-          UCHAR_MAX * (db_mag - min_decibels) * range_scale_factor;
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
-    }
+    ForEachMaxValue(len, write_byte);
   } else {
     for (size_t i = 0; i < len; ++i) {
       float linear_value = fudge_factor_ * source[i];
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-
-      // The range m_minDecibels to m_maxDecibels will be scaled to byte values
-      // from 0 to UCHAR_MAX.
-      double scaled_value =
-          UCHAR_MAX * (db_mag - min_decibels) * range_scale_factor;
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
+      write_byte(i, linear_value);
     }
   }
 }
@@ -178,19 +197,16 @@ void BraveAudioFarblingHelper::FarbleConvertToByteData(
 void BraveAudioFarblingHelper::FarbleConvertFloatToDb(const float* source,
                                                       float* destination,
                                                       size_t len) const {
+  auto write_db = [destination](size_t i, float linear_value) {
+    double db_mag = audio_utilities::LinearToDecibels(linear_value);
+    destination[i] = static_cast<float>(db_mag);
+  };
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float linear_value = (v / maxUInt64AsDouble) / 10;
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-      destination[i] = static_cast<float>(db_mag);
-    }
+    ForEachMaxValue(len, write_db);
   } else {
     for (size_t i = 0; i < len; ++i) {
       float linear_value = fudge_factor_ * source[i];
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-      destination[i] = static_cast<float>(db_mag);
+      write_db(i, linear_value);
     }
   }
 }
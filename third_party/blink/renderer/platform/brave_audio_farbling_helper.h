@@ -9,6 +9,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <vector>
+
 #include "third_party/blink/renderer/platform/platform_export.h"
 
 namespace blink {
@@ -41,9 +43,20 @@ class PLATFORM_EXPORT BraveAudioFarblingHelper final {
                               size_t len) const;
 
  private:
+  // In max mode every call produces the same pseudo-random sequence starting
+  // from |seed_|, so its values are generated once and reused. Only the first
+  // values are cached, longer buffers continue from |max_values_state_|.
+  void EnsureMaxValues(size_t count) const;
+  template <typename Fn>
+  void ForEachMaxValue(size_t len, Fn fn) const;
+
   double fudge_factor_;
   uint64_t seed_;
   bool max_;
+
+  mutable std::vector<float> max_values_;
+  // Generator state after the last value in |max_values_|.
+  mutable uint64_t max_values_state_;
 };
 
 }  // namespace blink
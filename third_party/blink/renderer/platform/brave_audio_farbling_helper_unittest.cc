@@ -0,0 +1,129 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
+
+#include <limits.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/audio/audio_utilities.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint64_t kSeed = 0x0123456789abcdefULL;
+constexpr double kFudgeFactor = 0.99;
+constexpr unsigned kInputBufferSize = 4096;
+constexpr unsigned kFftSize = 2048;
+
+// Reference implementation of the farbled sample generator, one step per
+// sample.
+std::vector<float> ReferenceMaxValues(uint64_t seed, size_t len) {
+  std::vector<float> values(len);
+  uint64_t v = seed;
+  for (size_t i = 0; i < len; ++i) {
+    v = ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~uint64_t{0} << 63) << 62)));
+    values[i] = (v / static_cast<double>(UINT64_MAX)) / 10;
+  }
+  return values;
+}
+
+std::vector<float> MakeInput(size_t len) {
+  std::vector<float> input(len);
+  for (size_t i = 0; i < len; ++i) {
+    input[i] = static_cast<float>(i % 200) / 100 - 1;
+  }
+  return input;
+}
+
+unsigned char ReferenceByte(double scaled_value) {
+  if (scaled_value < 0) {
+    scaled_value = 0;
+  }
+  if (scaled_value > UCHAR_MAX) {
+    scaled_value = UCHAR_MAX;
+  }
+  return static_cast<unsigned char>(scaled_value);
+}
+
+}  // namespace
+
+TEST(BraveAudioFarblingHelperTest, MaxAudioChannelMatchesReference) {
+  BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, true);
+  // Lengths below, at and above the number of cached values, repeated so the
+  // cache is both filled and reused.
+  for (size_t len : {1u, 1000u, 32768u, 100000u, 1000u, 100000u}) {
+    const std::vector<float> expected = ReferenceMaxValues(kSeed, len);
+    std::vector<float> actual(len, 1.0f);
+    helper.FarbleAudioChannel(actual.data(), len);
+    EXPECT_EQ(expected, actual) << len;
+  }
+}
+
+TEST(BraveAudioFarblingHelperTest, AudioChannelMatchesReference) {
+  BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, false);
+  std::vector<float> actual = MakeInput(1000);
+  const std::vector<float> input = actual;
+  helper.FarbleAudioChannel(actual.data(), actual.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    EXPECT_EQ(static_cast<float>(input[i] * kFudgeFactor), actual[i]);
+  }
+}
+
+TEST(BraveAudioFarblingHelperTest, TimeDomainDataMatchesReference) {
+  const std::vector<float> input = MakeInput(kInputBufferSize);
+  for (bool max : {false, true}) {
+    BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, max);
+    const std::vector<float> max_values = ReferenceMaxValues(kSeed, kFftSize);
+    // Write positions that do and don't wrap around the input buffer.
+    for (unsigned write_index : {0u, 100u, kFftSize, kInputBufferSize - 1}) {
+      std::vector<float> float_data(kFftSize);
+      std::vector<unsigned char> byte_data(kFftSize);
+      helper.FarbleFloatTimeDomainData(input.data(), float_data.data(),
+                                       kFftSize, write_index, kFftSize,
+                                       kInputBufferSize);
+      helper.FarbleByteTimeDomainData(input.data(), byte_data.data(), kFftSize,
+                                      write_index, kFftSize, kInputBufferSize);
+      for (size_t i = 0; i < kFftSize; ++i) {
+        float value =
+            max ? max_values[i]
+                : kFudgeFactor *
+                      input[(i + write_index - kFftSize + kInputBufferSize) %
+                            kInputBufferSize];
+        EXPECT_EQ(value, float_data[i]);
+        EXPECT_EQ(ReferenceByte(128 * (value + 1)), byte_data[i]);
+      }
+    }
+  }
+}
+
+TEST(BraveAudioFarblingHelperTest, FrequencyDataMatchesReference) {
+  constexpr double kMinDecibels = -100;
+  constexpr double kRangeScaleFactor = 1.0 / 70;
+  const size_t len = kFftSize / 2;
+  const std::vector<float> input = MakeInput(len);
+  for (bool max : {false, true}) {
+    BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, max);
+    const std::vector<float> max_values = ReferenceMaxValues(kSeed, len);
+    std::vector<float> db_data(len);
+    std::vector<unsigned char> byte_data(len);
+    helper.FarbleConvertFloatToDb(input.data(), db_data.data(), len);
+    helper.FarbleConvertToByteData(input.data(), byte_data.data(), len,
+                                   kMinDecibels, kRangeScaleFactor);
+    for (size_t i = 0; i < len; ++i) {
+      float linear_value = max ? max_values[i] : kFudgeFactor * input[i];
+      double db_mag = audio_utilities::LinearToDecibels(linear_value);
+      EXPECT_EQ(static_cast<float>(db_mag), db_data[i]);
+      EXPECT_EQ(ReferenceByte(UCHAR_MAX * (db_mag - kMinDecibels) *
+                              kRangeScaleFactor),
+                byte_data[i]);
+    }
+  }
+}
+
+}  // namespace blink